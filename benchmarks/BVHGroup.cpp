@@ -0,0 +1,95 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2020 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/maths/transform.h>
+#include <vsg/nodes/BVHGroup.h>
+#include <vsg/nodes/CullNode.h>
+#include <vsg/traversals/RecordTraversal.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <vector>
+
+using namespace vsg;
+
+using clock_type = std::chrono::steady_clock;
+
+static std::size_t s_numVisited = 0;
+
+class Leaf : public Inherit<Node, Leaf>
+{
+public:
+    void traverse(RecordTraversal&) const override { ++s_numVisited; }
+};
+
+static double median(std::vector<double> values)
+{
+    std::sort(values.begin(), values.end());
+    return values[values.size() / 2];
+}
+
+// compare culling 50000 bounded children of a flat Group, testing each child in turn, with the same children in a BVHGroup
+int main()
+{
+    std::mt19937 rng(5);
+    std::uniform_real_distribution<double> u(-5000.0, 5000.0), r(0.0, 20.0);
+
+    const std::size_t numChildren = 50000;
+    auto group = Group::create();
+    auto bvhGroup = BVHGroup::create();
+    for (std::size_t i = 0; i < numChildren; ++i)
+    {
+        auto child = CullNode::create(dsphere(dvec3(u(rng), u(rng), u(rng) * 0.05), r(rng)), Leaf::create());
+        group->addChild(child);
+        bvhGroup->addChild(child);
+    }
+
+    auto buildStart = clock_type::now();
+    bvhGroup->build();
+    std::cout << "build " << numChildren << " children: " << std::chrono::duration<double, std::milli>(clock_type::now() - buildStart).count() << "ms, " << bvhGroup->getCells().size() << " cells" << std::endl;
+
+    // narrow and wide fields of view, rotating around the center of the scene
+    for (double fov : {10.0, 60.0})
+    {
+        auto projection = perspective(radians(fov), 1.5, 1.0, 10000.0);
+
+        const int numFrames = 500;
+        std::vector<double> times[2];
+        std::size_t numVisited[2] = {0, 0};
+        Node* scenes[2] = {group.get(), bvhGroup.get()};
+        for (int frame = 0; frame < numFrames; ++frame)
+        {
+            double angle = frame * 0.01;
+            auto view = lookAt(dvec3(0.0, 0.0, 10.0), dvec3(std::cos(angle), std::sin(angle), 10.0), dvec3(0.0, 0.0, 1.0));
+            for (int i = 0; i < 2; ++i)
+            {
+                RecordTraversal recordTraversal;
+                recordTraversal.setProjectionAndViewMatrix(projection, view);
+
+                s_numVisited = 0;
+                auto start = clock_type::now();
+                scenes[i]->accept(recordTraversal);
+                times[i].push_back(std::chrono::duration<double, std::micro>(clock_type::now() - start).count());
+                numVisited[i] += s_numVisited;
+            }
+        }
+
+        std::cout << "fov " << fov << " degrees, " << (numVisited[0] / numFrames) << " visible: median Group " << median(times[0]) << "us, BVHGroup " << median(times[1]) << "us";
+        if (numVisited[0] != numVisited[1]) std::cout << " (BVHGroup visited " << (numVisited[1] / numFrames) << ")";
+        std::cout << std::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,78 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2020 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/io/DatabasePager.h>
+#include <vsg/io/read.h>
+#include <vsg/nodes/Node.h>
+#include <vsg/viewer/CameraPath.h>
+
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
+using namespace vsg;
+
+// replay a recorded CameraPath against a paged scene graph without a window, reporting the paging statistics so changes to the DatabasePager can be compared on the same camera motion
+int main(int argc, char** argv)
+{
+    if (argc < 3)
+    {
+        std::cout << "usage: " << argv[0] << " scene.vsgb path.vsgt [--fast] [--threads n] [--host-memory bytes] [--max-paged-lods n]" << std::endl;
+        std::cout << "    --fast              replay frames back to back rather than paced to the recorded sample times" << std::endl;
+        std::cout << "    --threads n         number of DatabasePager read threads" << std::endl;
+        std::cout << "    --host-memory bytes DatabasePager::targetMaxHostMemory" << std::endl;
+        std::cout << "    --max-paged-lods n  DatabasePager::targetMaxNumPagedLODWithHighResSubgraphs" << std::endl;
+        return 1;
+    }
+
+    auto scene = read_cast<Node>(argv[1]);
+    if (!scene)
+    {
+        std::cout << "Unable to read scene " << argv[1] << std::endl;
+        return 1;
+    }
+
+    auto path = read_cast<CameraPath>(argv[2]);
+    if (!path)
+    {
+        std::cout << "Unable to read camera path " << argv[2] << std::endl;
+        return 1;
+    }
+
+    auto databasePager = DatabasePager::create();
+    bool realTime = true;
+    for (int i = 3; i < argc; ++i)
+    {
+        if (std::strcmp(argv[i], "--fast") == 0) realTime = false;
+        else if (std::strcmp(argv[i], "--threads") == 0 && i + 1 < argc) databasePager->numReadThreads = static_cast<uint32_t>(std::atoi(argv[++i]));
+        else if (std::strcmp(argv[i], "--host-memory") == 0 && i + 1 < argc) databasePager->targetMaxHostMemory = std::strtoull(argv[++i], nullptr, 10);
+        else if (std::strcmp(argv[i], "--max-paged-lods") == 0 && i + 1 < argc) databasePager->targetMaxNumPagedLODWithHighResSubgraphs = static_cast<uint32_t>(std::atoi(argv[++i]));
+    }
+
+    auto replay = CameraPathReplay::create(path, scene, databasePager);
+    replay->realTime = realTime;
+
+    auto results = replay->run();
+
+    std::cout << "frames " << results.numFrames << std::endl;
+    std::cout << "frames with missing high res subgraphs " << results.numFramesWithMissingHighRes << std::endl;
+    if (results.reachedFullResolution)
+        std::cout << "time to full resolution after the end of the path " << results.timeToFullResolution << "s" << std::endl;
+    else
+        std::cout << "full resolution not reached within " << replay->maxSettleFrames << " frames of the end of the path" << std::endl;
+    std::cout << "peak high res subgraphs " << results.peakNumHighResSubgraphs << std::endl;
+    std::cout << "peak host memory " << results.peakHostMemory << " bytes" << std::endl;
+
+    databasePager->stats->print(std::cout);
+
+    return 0;
+}
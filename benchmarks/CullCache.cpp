@@ -0,0 +1,124 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2020 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/maths/transform.h>
+#include <vsg/nodes/CullGroup.h>
+#include <vsg/nodes/CullNode.h>
+#include <vsg/nodes/LOD.h>
+#include <vsg/traversals/CullCache.h>
+#include <vsg/traversals/RecordTraversal.h>
+#include <vsg/ui/ApplicationEvent.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <vector>
+
+using namespace vsg;
+
+using clock_type = std::chrono::steady_clock;
+
+static std::size_t s_numVisited = 0;
+
+class Leaf : public Inherit<Node, Leaf>
+{
+public:
+    void traverse(RecordTraversal&) const override { ++s_numVisited; }
+};
+
+// 100 CullGroups each of 1000 bounded children, one in ten of them LODs
+static ref_ptr<Node> createScene()
+{
+    std::mt19937 rng(5);
+    std::uniform_real_distribution<double> u(-5000.0, 5000.0), r(0.0, 20.0);
+
+    auto root = Group::create();
+    for (int g = 0; g < 100; ++g)
+    {
+        dvec3 center(u(rng), u(rng), u(rng) * 0.05);
+        auto cullGroup = CullGroup::create(dsphere(center, 400.0));
+        for (int i = 0; i < 1000; ++i)
+        {
+            dsphere bound(center + dvec3(u(rng) * 0.05, u(rng) * 0.05, u(rng) * 0.01), r(rng));
+            if (i % 10 == 0)
+            {
+                auto lod = LOD::create();
+                lod->setBound(bound);
+                lod->addChild(LOD::Child{0.05, Leaf::create()});
+                lod->addChild(LOD::Child{0.0, Leaf::create()});
+                cullGroup->addChild(lod);
+            }
+            else
+            {
+                cullGroup->addChild(CullNode::create(bound, Leaf::create()));
+            }
+        }
+        root->addChild(cullGroup);
+    }
+    return root;
+}
+
+static double median(std::vector<double> values)
+{
+    std::sort(values.begin(), values.end());
+    return values[values.size() / 2];
+}
+
+int main()
+{
+    auto scene = createScene();
+    dmat4 projection = perspective(1.0, 1.5, 1.0, 10000.0);
+
+    auto viewAt = [](int frame, double speed) {
+        double angle = frame * speed;
+        dvec3 eye(std::sin(angle * 3.0) * 50.0, 0.0, 10.0);
+        return lookAt(eye, eye + dvec3(std::cos(angle), std::sin(angle), 0.1), dvec3(0.0, 0.0, 1.0));
+    };
+
+    // compare the median time per frame of an uncached traversal, a cache with the default thresholds of 0.0 and a cache with non zero thresholds, for static and rotating cameras
+    for (double speed : {0.0, 0.0002, 0.002})
+    {
+        RecordTraversal uncached, exact, thresholds;
+        exact.setCullCache(CullCache::create());
+        auto thresholdsCache = CullCache::create();
+        thresholdsCache->eyeMovementThreshold = 1.0;
+        thresholdsCache->rotationThreshold = 0.01;
+        thresholds.setCullCache(thresholdsCache);
+
+        const int numFrames = 2000;
+        std::vector<double> times[3];
+        std::size_t numVisited = 0;
+        for (int frame = 0; frame < numFrames; ++frame)
+        {
+            auto view = viewAt(frame, speed);
+            RecordTraversal* recordTraversals[3] = {&uncached, &exact, &thresholds};
+            for (int i = 0; i < 3; ++i)
+            {
+                auto& recordTraversal = *recordTraversals[i];
+                recordTraversal.setFrameStamp(FrameStamp::create(clock_type::now(), frame));
+                recordTraversal.setProjectionAndViewMatrix(projection, view);
+
+                s_numVisited = 0;
+                auto start = clock_type::now();
+                scene->accept(recordTraversal);
+                times[i].push_back(std::chrono::duration<double, std::micro>(clock_type::now() - start).count());
+                if (i == 0) numVisited += s_numVisited;
+            }
+        }
+
+        std::cout << "rotation " << speed << " rad/frame, " << (numVisited / numFrames) << " visible: median uncached " << median(times[0]) << "us, cached " << median(times[1]) << "us, cached with thresholds " << median(times[2]) << "us" << std::endl;
+    }
+
+    return 0;
+}
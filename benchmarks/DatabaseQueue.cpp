@@ -0,0 +1,91 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2020 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/io/DatabasePager.h>
+
+#include <chrono>
+#include <iostream>
+#include <list>
+#include <random>
+#include <vector>
+
+using namespace vsg;
+
+using clock_type = std::chrono::steady_clock;
+
+static double nanoseconds(clock_type::time_point start, clock_type::time_point end, std::size_t count)
+{
+    return std::chrono::duration<double, std::nano>(end - start).count() / double(count);
+}
+
+// time take() followed by add() of a new request with numPending requests queued, so the queue size stays constant, compared with a linear scan of a std::list
+static void benchmark(std::size_t numPending, std::size_t numTakes)
+{
+    std::mt19937 rng(1);
+    std::uniform_real_distribution<double> u(0.0, 1000.0);
+
+    std::vector<ref_ptr<PagedLOD>> plods(numPending + numTakes);
+    for (auto& plod : plods)
+    {
+        plod = PagedLOD::create();
+        plod->priority = u(rng);
+    }
+
+    auto queue = DatabaseQueue::create(ActivityStatus::create());
+    for (std::size_t i = 0; i < numPending; ++i) queue->add(plods[i]);
+
+    auto start = clock_type::now();
+    for (std::size_t i = 0; i < numTakes; ++i)
+    {
+        auto plod = queue->take();
+        queue->add(plods[numPending + i]);
+    }
+    auto heapEnd = clock_type::now();
+
+    // updatePriority() of random queued requests, as RecordTraversal does when it finds a requested PagedLOD is still visible
+    auto pending = queue->take_all();
+    queue->add(pending);
+    auto updateStart = clock_type::now();
+    for (std::size_t i = 0; i < numTakes; ++i)
+    {
+        auto& plod = pending[rng() % pending.size()];
+        plod->priority = plod->priority.load() + 1.0;
+        queue->updatePriority(plod);
+    }
+    auto updateEnd = clock_type::now();
+
+    // the std::list with a linear scan for the highest priority that DatabaseQueue previously used
+    std::list<ref_ptr<PagedLOD>> list(plods.begin(), plods.begin() + numPending);
+    auto listStart = clock_type::now();
+    for (std::size_t i = 0; i < numTakes; ++i)
+    {
+        auto highest = list.begin();
+        for (auto itr = list.begin(); itr != list.end(); ++itr)
+        {
+            if ((*itr)->priority.load() > (*highest)->priority.load()) highest = itr;
+        }
+        list.erase(highest);
+        list.push_back(plods[numPending + i]);
+    }
+    auto listEnd = clock_type::now();
+
+    std::cout << numPending << " pending: take() + add() " << nanoseconds(start, heapEnd, numTakes) << "ns, updatePriority() " << nanoseconds(updateStart, updateEnd, numTakes) << "ns, std::list scan + push_back " << nanoseconds(listStart, listEnd, numTakes) << "ns" << std::endl;
+}
+
+int main()
+{
+    for (std::size_t numPending : {100u, 1000u, 10000u, 100000u})
+    {
+        benchmark(numPending, 2000);
+    }
+    return 0;
+}
@@ -0,0 +1,99 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2020 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/threading/Barrier.h>
+#include <vsg/threading/FrameBlock.h>
+
+#include <chrono>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+using namespace vsg;
+
+using clock_type = std::chrono::steady_clock;
+
+// the calling thread and numThreads worker threads repeatedly meet at a Barrier, returns the average time per round trip in microseconds
+static double barrierRoundTrip(uint32_t numThreads, uint32_t spinCount, uint32_t numRounds)
+{
+    auto barrier = Barrier::create(1 + numThreads, spinCount);
+
+    std::vector<std::thread> threads;
+    for (uint32_t t = 0; t < numThreads; ++t)
+    {
+        threads.emplace_back([&]() {
+            for (uint32_t r = 0; r < numRounds; ++r) barrier->arrive_and_wait();
+        });
+    }
+
+    auto start = clock_type::now();
+    for (uint32_t r = 0; r < numRounds; ++r) barrier->arrive_and_wait();
+    auto end = clock_type::now();
+
+    for (auto& thread : threads) thread.join();
+
+    return std::chrono::duration<double, std::micro>(end - start).count() / double(numRounds);
+}
+
+// the calling thread sets a new FrameStamp on a FrameBlock and waits on a Barrier for numThreads worker threads to see it and arrive, the handoff Viewer::setupThreading() does every frame, returns the average time per frame in microseconds
+static double frameBlockRoundTrip(uint32_t numThreads, uint32_t spinCount, uint32_t numFrames)
+{
+    auto status = ActivityStatus::create();
+    auto frameBlock = FrameBlock::create(status, spinCount);
+    auto completed = Barrier::create(1 + numThreads, spinCount);
+
+    std::vector<std::thread> threads;
+    for (uint32_t t = 0; t < numThreads; ++t)
+    {
+        threads.emplace_back([&]() {
+            auto frameStamp = frameBlock->initial_value;
+            while (frameBlock->wait_for_change(frameStamp))
+            {
+                completed->arrive_and_wait();
+            }
+        });
+    }
+
+    auto start = clock_type::now();
+    for (uint32_t f = 0; f < numFrames; ++f)
+    {
+        frameBlock->set(FrameStamp::create(clock_type::now(), f));
+        completed->arrive_and_wait();
+    }
+    auto end = clock_type::now();
+
+    status->set(false);
+    frameBlock->wake();
+    for (auto& thread : threads) thread.join();
+
+    return std::chrono::duration<double, std::micro>(end - start).count() / double(numFrames);
+}
+
+int main()
+{
+    const uint32_t numRounds = 2000;
+
+    // spinning only pays off when there is a core free for each waiting thread, on oversubscribed systems it delays the threads being waited for
+    const uint32_t spinCounts[] = {0, 1000, 10000};
+
+    for (uint32_t numThreads : {1u, 2u, 4u, 8u, 16u})
+    {
+        std::cout << numThreads << " threads :";
+        for (auto spinCount : spinCounts)
+        {
+            std::cout << " spinCount " << spinCount << " Barrier " << barrierRoundTrip(numThreads, spinCount, numRounds) << "us, FrameBlock " << frameBlockRoundTrip(numThreads, spinCount, numRounds) << "us;";
+        }
+        std::cout << std::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,83 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2020 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/core/Value.h>
+
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace vsg;
+
+using clock_type = std::chrono::steady_clock;
+
+// measure meta data get/set throughput for objects with numKeys entries, looking up by std::string and by InternedString
+static void benchmark(int numKeys, int numIterations)
+{
+    std::vector<std::string> keys;
+    std::vector<InternedString> internedKeys;
+    for (int i = 0; i < numKeys; ++i)
+    {
+        keys.push_back("key" + std::to_string(i));
+        internedKeys.emplace_back(keys.back());
+    }
+
+    ref_ptr<Object> object(new Object);
+    for (auto& key : internedKeys) object->setValue(key, 0);
+
+    auto nanoseconds = [&](clock_type::time_point start, clock_type::time_point end) {
+        return std::chrono::duration<double, std::nano>(end - start).count() / (double(numIterations) * double(numKeys));
+    };
+
+    int sum = 0;
+    auto start = clock_type::now();
+    for (int i = 0; i < numIterations; ++i)
+    {
+        for (auto& key : keys)
+        {
+            int value = 0;
+            object->getValue(key, value);
+            sum += value;
+        }
+    }
+    auto stringGet = clock_type::now();
+    for (int i = 0; i < numIterations; ++i)
+    {
+        for (auto& key : internedKeys)
+        {
+            int value = 0;
+            object->getValue(key, value);
+            sum += value;
+        }
+    }
+    auto internedGet = clock_type::now();
+    for (int i = 0; i < numIterations; ++i)
+    {
+        for (auto& key : keys) object->setValue(key, i);
+    }
+    auto stringSet = clock_type::now();
+    for (int i = 0; i < numIterations; ++i)
+    {
+        for (auto& key : internedKeys) object->setValue(key, i);
+    }
+    auto internedSet = clock_type::now();
+
+    std::cout << numKeys << " keys: get std::string " << nanoseconds(start, stringGet) << "ns, InternedString " << nanoseconds(stringGet, internedGet) << "ns, ";
+    std::cout << "set std::string " << nanoseconds(internedGet, stringSet) << "ns, InternedString " << nanoseconds(stringSet, internedSet) << "ns (" << sum << ")" << std::endl;
+}
+
+int main()
+{
+    for (int numKeys : {1, 4, 16}) benchmark(numKeys, 1000000 / numKeys);
+    return 0;
+}
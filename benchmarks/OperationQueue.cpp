@@ -0,0 +1,133 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2020 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/threading/OperationQueue.h>
+
+#include <chrono>
+#include <iostream>
+#include <list>
+#include <thread>
+#include <vector>
+
+using namespace vsg;
+
+using clock_type = std::chrono::steady_clock;
+
+struct Noop : public Inherit<Operation, Noop>
+{
+    void run() override {}
+};
+
+// the mutex and condition variable protected std::list that OperationQueue used before the RingQueue, as a baseline
+class LockedQueue
+{
+public:
+    void add(ref_ptr<Operation> operation)
+    {
+        {
+            std::scoped_lock<std::mutex> lock(_mutex);
+            _queue.emplace_back(operation);
+        }
+        _cv.notify_one();
+    }
+
+    ref_ptr<Operation> take_when_avilable(ActivityStatus* status)
+    {
+        std::unique_lock lock(_mutex);
+        _cv.wait(lock, [&]() { return !_queue.empty() || status->cancel(); });
+        if (_queue.empty()) return {};
+
+        auto operation = _queue.front();
+        _queue.pop_front();
+        return operation;
+    }
+
+    void release()
+    {
+        std::scoped_lock<std::mutex> lock(_mutex);
+        _cv.notify_all();
+    }
+
+protected:
+    std::mutex _mutex;
+    std::condition_variable _cv;
+    std::list<ref_ptr<Operation>> _queue;
+};
+
+// numThreads are split evenly between producers adding operations and consumers taking them, with at least one of each, returns the average ns per operation
+template<class Queue, typename Take>
+double benchmark(Queue& queue, ActivityStatus* status, unsigned int numThreads, Take take)
+{
+    const unsigned int numProducers = std::max(1u, numThreads / 2);
+    const unsigned int numConsumers = std::max(1u, numThreads - numProducers);
+    const unsigned int total = 1000000;
+    const unsigned int numPerProducer = total / numProducers;
+
+    std::vector<ref_ptr<Operation>> operations(numPerProducer);
+    for (auto& operation : operations) operation = Noop::create();
+
+    std::atomic_uint numTaken{0};
+    std::vector<std::thread> threads;
+
+    auto start = clock_type::now();
+    for (unsigned int c = 0; c < numConsumers; ++c)
+    {
+        threads.emplace_back([&]() {
+            while (take())
+            {
+                if (++numTaken == numProducers * numPerProducer)
+                {
+                    status->set(false);
+                    queue.release();
+                }
+            }
+        });
+    }
+
+    for (unsigned int p = 0; p < numProducers; ++p)
+    {
+        threads.emplace_back([&]() {
+            for (auto& operation : operations) queue.add(operation);
+        });
+    }
+
+    for (auto& thread : threads) thread.join();
+    auto end = clock_type::now();
+
+    return std::chrono::duration<double, std::nano>(end - start).count() / double(numProducers * numPerProducer);
+}
+
+int main()
+{
+    for (unsigned int numThreads : {1u, 2u, 4u, 8u, 16u, 32u, 64u})
+    {
+        std::cout << numThreads << " threads :";
+
+        {
+            auto status = ActivityStatus::create();
+            LockedQueue queue;
+            std::cout << " mutex list " << benchmark(queue, status.get(), numThreads, [&]() { return queue.take_when_avilable(status.get()); }) << "ns";
+        }
+
+        // with the default capacity the ring absorbs bursts, with a capacity of 16 the producers overrun the ring and spill into the overflow list
+        for (size_t capacity : {size_t(1024), size_t(16)})
+        {
+            auto status = ActivityStatus::create();
+            auto queue = OperationQueue::create(status, capacity);
+            std::cout << ", OperationQueue(" << capacity << ") " << benchmark(*queue, status.get(), numThreads, [&]() { return queue->take_when_avilable(); }) << "ns";
+        }
+
+        std::cout << std::endl;
+    }
+
+    return 0;
+}
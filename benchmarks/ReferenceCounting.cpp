@@ -0,0 +1,91 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2020 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/nodes/Group.h>
+
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <thread>
+
+using namespace vsg;
+
+using clock_type = std::chrono::steady_clock;
+
+static double milliseconds(clock_type::time_point start, clock_type::time_point end)
+{
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+// sequentially consistent reference count, as Object used before ref() was relaxed and unref() acq_rel, as a baseline
+struct SeqCstCount
+{
+    std::atomic_uint count{0};
+
+    void ref() { count.fetch_add(1); }
+    bool unref() { return count.fetch_sub(1) <= 1; }
+};
+
+// build a million node graph of 1000 groups of 1000 children, with the builder taking an extra reference to each child while it's being set up
+static ref_ptr<Group> build()
+{
+    auto root = Group::create();
+    for (int i = 0; i < 1000; ++i)
+    {
+        auto group = Group::create();
+        for (int j = 0; j < 1000; ++j)
+        {
+            ref_ptr<Node> held(Group::create());
+            group->addChild(held);
+        }
+        root->addChild(group);
+    }
+    return root;
+}
+
+int main()
+{
+    constexpr int numIterations = 100000000;
+    auto node = Node::create();
+
+    auto start = clock_type::now();
+    for (int i = 0; i < numIterations; ++i)
+    {
+        node->ref();
+        node->unref();
+    }
+    auto objectEnd = clock_type::now();
+
+    SeqCstCount seqCst;
+    int numReleased = 0;
+    for (int i = 0; i < numIterations; ++i)
+    {
+        seqCst.ref();
+        if (seqCst.unref()) ++numReleased;
+    }
+    auto seqCstEnd = clock_type::now();
+
+    std::cout << "Object ref()/unref() " << milliseconds(start, objectEnd) * 1e6 / numIterations << "ns, seq_cst baseline " << milliseconds(objectEnd, seqCstEnd) * 1e6 / numIterations << "ns (" << numReleased << " releases)" << std::endl;
+
+    // build the graph on this thread then hand it off to another thread to release it
+    auto buildStart = clock_type::now();
+    auto root = build();
+    auto built = clock_type::now();
+
+    std::thread([r = root]() mutable { r = {}; }).join();
+    root = {};
+    auto released = clock_type::now();
+
+    std::cout << "build " << milliseconds(buildStart, built) << "ms, teardown " << milliseconds(built, released) << "ms" << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,80 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2020 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/core/SlabAllocator.h>
+#include <vsg/nodes/Group.h>
+
+#include <chrono>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+using namespace vsg;
+
+using clock_type = std::chrono::steady_clock;
+
+// build a tile of numGroups groups each of numChildren children, using the allocator when one is provided otherwise the global heap
+static ref_ptr<Group> createTile(ref_ptr<Allocator> allocator, int numGroups, int numChildren)
+{
+    auto create = [&]() { return allocator ? Group::create(allocator) : Group::create(); };
+
+    auto tile = create();
+    for (int i = 0; i < numGroups; ++i)
+    {
+        auto group = create();
+        for (int j = 0; j < numChildren; ++j) group->addChild(create());
+        tile->addChild(group);
+    }
+    return tile;
+}
+
+// simulate paging, with reader threads building tiles and handing them to a thread that releases them
+static double churn(bool useSlabAllocator, int numThreads, int numTilesPerThread)
+{
+    auto start = clock_type::now();
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < numThreads; ++t)
+    {
+        threads.emplace_back([&]() {
+            std::vector<ref_ptr<Group>> tiles;
+            for (int i = 0; i < numTilesPerThread; ++i)
+            {
+                ref_ptr<Allocator> allocator;
+                if (useSlabAllocator) allocator = new SlabAllocator;
+                tiles.push_back(createTile(allocator, 100, 100));
+
+                // release the oldest tiles from another thread
+                if (tiles.size() > 4)
+                {
+                    std::thread([expired = tiles.front()]() mutable { expired = {}; }).join();
+                    tiles.erase(tiles.begin());
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) thread.join();
+
+    return std::chrono::duration<double, std::milli>(clock_type::now() - start).count();
+}
+
+int main(int argc, char** argv)
+{
+    int numThreads = argc > 1 ? std::atoi(argv[1]) : 4;
+    int numTilesPerThread = argc > 2 ? std::atoi(argv[2]) : 50;
+
+    std::cout << "threads " << numThreads << ", tiles per thread " << numTilesPerThread << ", nodes per tile " << (1 + 100 + 100 * 100) << std::endl;
+    std::cout << "global heap " << churn(false, numThreads, numTilesPerThread) << "ms" << std::endl;
+    std::cout << "SlabAllocator per tile " << churn(true, numThreads, numTilesPerThread) << "ms" << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,74 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2020 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/maths/plane.h>
+#include <vsg/maths/transform.h>
+
+#include <array>
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <vector>
+
+using namespace vsg;
+
+using clock_type = std::chrono::steady_clock;
+
+// compare testing spheres one at a time against the frustum polytope with the batched intersect()
+template<typename T>
+void benchmark(const char* name, std::size_t numPlanes)
+{
+    using plane_type = t_plane<T>;
+    using sphere_type = t_sphere<T>;
+
+    auto projection = perspective(T(1.0), T(1.5), T(1.0), T(1000.0)) * lookAt(t_vec3<T>(0, 0, 0), t_vec3<T>(1, 0.2, 0), t_vec3<T>(0, 0, 1));
+    std::array<plane_type, 6> clipPlanes{{plane_type(1, 0, 0, 1), plane_type(-1, 0, 0, 1), plane_type(0, 1, 0, 1), plane_type(0, -1, 0, 1), plane_type(0, 0, -1, 1), plane_type(0, 0, 1, 1)}};
+    std::vector<plane_type> planes;
+    for (std::size_t i = 0; i < numPlanes; ++i) planes.push_back(clipPlanes[i] * projection);
+
+    std::mt19937 rng(3);
+    std::uniform_real_distribution<double> u(-1500.0, 1500.0), r(0.0, 50.0);
+    const std::size_t numSpheres = 1000000;
+    std::vector<sphere_type> spheres(numSpheres);
+    for (auto& s : spheres) s = sphere_type(t_vec3<T>(T(u(rng)), T(u(rng)), T(u(rng) * 0.1)), T(r(rng)));
+    std::vector<uint8_t> visible(numSpheres);
+
+    const int numRepeats = 20;
+    std::size_t numVisible = 0;
+    auto start = clock_type::now();
+    for (int k = 0; k < numRepeats; ++k)
+    {
+        for (std::size_t i = 0; i < numSpheres; ++i) visible[i] = intersect(planes.begin(), planes.end(), spheres[i]) ? 1 : 0;
+        numVisible += visible[k];
+    }
+    auto scalarEnd = clock_type::now();
+    for (int k = 0; k < numRepeats; ++k)
+    {
+        numVisible += intersect(planes.data(), planes.size(), spheres.data(), numSpheres, visible.data());
+    }
+    auto batchedEnd = clock_type::now();
+
+    auto nanoseconds = [&](clock_type::time_point begin, clock_type::time_point end) {
+        return std::chrono::duration<double, std::nano>(end - begin).count() / (double(numSpheres) * numRepeats);
+    };
+    std::cout << name << " " << numPlanes << " planes: scalar " << nanoseconds(start, scalarEnd) << "ns/sphere, batched " << nanoseconds(scalarEnd, batchedEnd) << "ns/sphere (" << numVisible << ")" << std::endl;
+}
+
+int main()
+{
+    for (std::size_t numPlanes : {5u, 6u})
+    {
+        benchmark<float>("float", numPlanes);
+        benchmark<double>("double", numPlanes);
+    }
+    return 0;
+}
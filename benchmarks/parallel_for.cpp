@@ -0,0 +1,87 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2020 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/nodes/Group.h>
+#include <vsg/nodes/VertexIndexDraw.h>
+#include <vsg/threading/parallel_for.h>
+#include <vsg/traversals/ComputeBounds.h>
+
+#include <chrono>
+#include <iostream>
+#include <thread>
+
+using namespace vsg;
+
+using clock_type = std::chrono::steady_clock;
+
+// root Group with numChildren VertexIndexDraw children each with numVertices vertices
+static ref_ptr<Group> createScene(size_t numChildren, size_t numVertices)
+{
+    auto root = Group::create();
+    for (size_t i = 0; i < numChildren; ++i)
+    {
+        auto vertices = vec3Array::create(static_cast<uint32_t>(numVertices));
+        for (size_t v = 0; v < numVertices; ++v)
+        {
+            vertices->at(v) = vec3(float(i), float(v), float(i + v) * 0.5f);
+        }
+
+        auto vid = VertexIndexDraw::create();
+        vid->arrays = DataList{vertices};
+        root->addChild(vid);
+    }
+    return root;
+}
+
+template<typename Function>
+double milliseconds(int numIterations, Function function)
+{
+    auto start = clock_type::now();
+    for (int i = 0; i < numIterations; ++i) function();
+    return std::chrono::duration<double, std::milli>(clock_type::now() - start).count() / double(numIterations);
+}
+
+int main()
+{
+    const int numIterations = 10;
+    auto scene = createScene(4096, 1024);
+
+    double serial = milliseconds(numIterations, [&]() {
+        auto computeBounds = ComputeBounds::create();
+        scene->accept(*computeBounds);
+    });
+    std::cout << "serial ComputeBounds " << serial << "ms" << std::endl;
+
+    uint32_t maxThreads = std::max(2u, std::thread::hardware_concurrency());
+    for (uint32_t numThreads = 1; numThreads <= maxThreads; numThreads *= 2)
+    {
+        // parallel_for runs chunks on the calling thread as well, so use one fewer pool thread than the thread count being measured
+        auto operationThreads = OperationThreads::create(numThreads - 1);
+
+        double parallel = milliseconds(numIterations, [&]() {
+            auto computeBounds = ComputeBounds::create();
+            computeBounds->operationThreads = operationThreads;
+            scene->accept(*computeBounds);
+        });
+
+        // the bare parallel_for overhead for the same number of chunks with no work in each
+        double overhead = milliseconds(numIterations, [&]() {
+            parallel_for(operationThreads.get(), 0, scene->getChildren().size(), 64, [](size_t, size_t) {});
+        });
+
+        std::cout << numThreads << " threads : parallel ComputeBounds " << parallel << "ms, speedup " << (serial / parallel) << ", empty parallel_for " << overhead << "ms" << std::endl;
+
+        operationThreads->stop();
+    }
+
+    return 0;
+}
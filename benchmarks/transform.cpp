@@ -0,0 +1,76 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2020 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/maths/transform.h>
+
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+using namespace vsg;
+
+using clock_type = std::chrono::steady_clock;
+
+template<typename T>
+void benchmark(const char* name)
+{
+    using mat_type = t_mat4<T>;
+    using vec_type = t_vec3<T>;
+
+    auto nanoseconds = [](clock_type::time_point start, clock_type::time_point end, double count) {
+        return std::chrono::duration<double, std::nano>(end - start).count() / count;
+    };
+
+    mat_type matrix = perspective(T(1.0), T(1.3), T(0.1), T(100.0)) * translate(T(1.0), T(2.0), T(3.0)) * rotate(T(0.3), vec_type(T(0.0), T(0.0), T(1.0)));
+
+    // vertex transforms, comparing the scalar template with the batched transform()
+    const std::size_t numVertices = 4096;
+    const int numRepeats = 2000;
+    std::vector<vec_type> in(numVertices), out(numVertices);
+    for (std::size_t i = 0; i < numVertices; ++i) in[i].set(T(i % 7), T(i % 11), T(i % 13));
+
+    T sum = 0;
+    auto start = clock_type::now();
+    for (int r = 0; r < numRepeats; ++r)
+    {
+        for (std::size_t i = 0; i < numVertices; ++i) out[i] = matrix * in[i];
+        sum += out[r % numVertices].x;
+    }
+    auto scalarEnd = clock_type::now();
+    for (int r = 0; r < numRepeats; ++r)
+    {
+        transform(matrix, in.data(), out.data(), numVertices);
+        sum += out[r % numVertices].x;
+    }
+    auto batchedEnd = clock_type::now();
+
+    double numTransforms = double(numVertices) * double(numRepeats);
+    std::cout << name << " vertex transform: scalar " << nanoseconds(start, scalarEnd, numTransforms) << "ns, transform() " << nanoseconds(scalarEnd, batchedEnd, numTransforms) << "ns" << std::endl;
+
+    // affine inverse, each inverse depending on the previous so latency is measured
+    const int numInverses = 10000000;
+    mat_type m = translate(T(1.0), T(2.0), T(3.0)) * rotate(T(0.3), vec_type(T(0.0), T(0.0), T(1.0)));
+    start = clock_type::now();
+    for (int i = 0; i < numInverses; ++i) m = inverse_4x4(m);
+    auto inverse4x4End = clock_type::now();
+    for (int i = 0; i < numInverses; ++i) m = inverse_4x3(m);
+    auto inverse4x3End = clock_type::now();
+
+    std::cout << name << " inverse: inverse_4x4() " << nanoseconds(start, inverse4x4End, numInverses) << "ns, inverse_4x3() " << nanoseconds(inverse4x4End, inverse4x3End, numInverses) << "ns (" << (sum + m[3][0]) << ")" << std::endl;
+}
+
+int main()
+{
+    benchmark<float>("float");
+    benchmark<double>("double");
+    return 0;
+}
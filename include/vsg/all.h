@@ -14,6 +14,7 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 
 // Core header files
 #include <vsg/core/Allocator.h>
+#include <vsg/core/ArenaAllocator.h>
 #include <vsg/core/Array.h>
 #include <vsg/core/Array2D.h>
 #include <vsg/core/Array3D.h>
@@ -24,9 +25,12 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <vsg/core/Export.h>
 #include <vsg/core/External.h>
 #include <vsg/core/Inherit.h>
+#include <vsg/core/InternedString.h>
 #include <vsg/core/Object.h>
+#include <vsg/core/ObjectMap.h>
 #include <vsg/core/Objects.h>
 #include <vsg/core/ScratchMemory.h>
+#include <vsg/core/SlabAllocator.h>
 #include <vsg/core/Value.h>
 #include <vsg/core/Version.h>
 #include <vsg/core/Visitor.h>
@@ -47,6 +51,7 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <vsg/maths/vec4.h>
 
 // Node header files
+#include <vsg/nodes/BVHGroup.h>
 #include <vsg/nodes/CullGroup.h>
 #include <vsg/nodes/CullNode.h>
 #include <vsg/nodes/Geometry.h>
@@ -99,6 +104,7 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <vsg/traversals/ArrayState.h>
 #include <vsg/traversals/CompileTraversal.h>
 #include <vsg/traversals/ComputeBounds.h>
+#include <vsg/traversals/CullCache.h>
 #include <vsg/traversals/Intersector.h>
 #include <vsg/traversals/LineSegmentIntersector.h>
 #include <vsg/traversals/LoadPagedLOD.h>
@@ -112,7 +118,11 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <vsg/threading/Latch.h>
 #include <vsg/threading/OperationQueue.h>
 #include <vsg/threading/OperationThreads.h>
+#include <vsg/threading/RingQueue.h>
+#include <vsg/threading/TaskGraph.h>
+#include <vsg/threading/WorkStealingQueue.h>
 #include <vsg/threading/atomics.h>
+#include <vsg/threading/parallel_for.h>
 
 // User Interface abstraction header files
 #include <vsg/ui/ApplicationEvent.h>
@@ -126,6 +136,7 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 
 // Viewer header files
 #include <vsg/viewer/Camera.h>
+#include <vsg/viewer/CameraPath.h>
 #include <vsg/viewer/CloseHandler.h>
 #include <vsg/viewer/CommandGraph.h>
 #include <vsg/viewer/CopyImageViewToWindow.h>
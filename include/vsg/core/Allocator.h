@@ -19,6 +19,8 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 
 #include <vsg/io/stream.h>
 
+#include <mutex>
+
 #include <vsg/traversals/RecordTraversal.h>
 
 namespace vsg
@@ -51,6 +53,19 @@ namespace vsg
             return nullptr;
         }
 
+        /// default construct an Object of type T in memory allocated by this Allocator and attach the Allocator's shared Auxiliary to it,
+        /// so that when the object is deleted its memory is returned to this Allocator, and the Allocator is kept alive while the object is referenced.
+        template<typename T>
+        ref_ptr<T> createObject()
+        {
+            void* ptr = allocate(sizeof(T));
+            if (!ptr) return {};
+
+            T* object = new (ptr) T();
+            _attachSharedAuxiliary(object);
+            return ref_ptr<T>(object);
+        }
+
         template<typename T>
         void deleteObject(T* ptr)
         {
@@ -86,18 +101,30 @@ namespace vsg
             }
         }
 
+        /// return the Auxiliary shared by the objects created by this Allocator, with its reference count incremented on behalf of the caller.
         Auxiliary* getOrCreateSharedAuxiliary();
 
         void detachSharedAuxiliary(Auxiliary* auxiliary);
 
+        std::size_t bytesAllocated() const { return _bytesAllocated.load(); }
+        std::size_t countAllocated() const { return _countAllocated.load(); }
+        std::size_t bytesDeallocated() const { return _bytesDeallocated.load(); }
+        std::size_t countDeallocated() const { return _countDeallocated.load(); }
+
+        /// print the allocation statistics to std::cout when the Allocator is destroyed.
+        bool reportStatistics = true;
+
     protected:
         virtual ~Allocator();
 
+        void _attachSharedAuxiliary(Object* object);
+
+        std::mutex _sharedAuxiliaryMutex;
         Auxiliary* _sharedAuxiliary = nullptr;
-        std::size_t _bytesAllocated = 0;
-        std::size_t _countAllocated = 0;
-        std::size_t _bytesDeallocated = 0;
-        std::size_t _countDeallocated = 0;
+        std::atomic_size_t _bytesAllocated{0};
+        std::atomic_size_t _countAllocated{0};
+        std::atomic_size_t _bytesDeallocated{0};
+        std::atomic_size_t _countDeallocated{0};
     };
 
 } // namespace vsg
@@ -0,0 +1,56 @@
+#pragma once
+
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2020 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/core/Allocator.h>
+
+#include <mutex>
+#include <vector>
+
+namespace vsg
+{
+
+    /// Bump pointer Allocator that places all its allocations in a small number of large blocks and releases them together when it's destroyed.
+    /// deallocate() only updates the statistics, memory isn't reused, so an ArenaAllocator suits groups of objects that are created together and discarded together,
+    /// such as the subgraph read from a file by BinaryInput when Options::arenaAllocation is set.
+    /// Objects created by the ArenaAllocator hold a reference to it via their shared Auxiliary, so the arena remains valid while any of its objects are still referenced.
+    class VSG_DECLSPEC ArenaAllocator : public Allocator
+    {
+    public:
+        explicit ArenaAllocator(std::size_t in_blockSize = 1048576);
+
+        std::size_t sizeofObject() const noexcept override { return sizeof(ArenaAllocator); }
+
+        static constexpr std::size_t alignment = 16;
+
+        const std::size_t blockSize;
+
+        void* allocate(std::size_t n, const void* hint) override;
+
+        void* allocate(std::size_t size) override;
+
+        void deallocate(const void* ptr, std::size_t size = 0) override;
+
+        /// number of blocks allocated from the system
+        std::size_t numBlocks() const;
+
+    protected:
+        virtual ~ArenaAllocator();
+
+        mutable std::mutex _mutex;
+        std::vector<void*> _blocks;
+        uint8_t* _current = nullptr;
+        uint8_t* _end = nullptr;
+    };
+
+} // namespace vsg
@@ -44,7 +44,7 @@ namespace vsg
 
         explicit Array(uint32_t numElements, Layout layout = {}) :
             Data(layout, sizeof(value_type)),
-            _data(new value_type[numElements]),
+            _data(_allocateData(numElements)),
             _size(numElements) {}
 
         Array(uint32_t numElements, value_type* data, Layout layout = {}) :
@@ -54,7 +54,7 @@ namespace vsg
 
         Array(uint32_t numElements, const value_type& value, Layout layout = {}) :
             Data(layout, sizeof(value_type)),
-            _data(new value_type[numElements]),
+            _data(_allocateData(numElements)),
             _size(numElements)
         {
             for (auto& v : *this) v = value;
@@ -138,15 +138,15 @@ namespace vsg
 
                 if (_data) // if data already may be able to reuse it
                 {
-                    if (original_total_size != new_total_size) // if existing data is a different size delete old, and create new
+                    if (original_total_size != new_total_size || !_isAligned(_data)) // if existing data is a different size or alignment delete old, and create new
                     {
-                        delete[] _data;
-                        _data = new value_type[new_total_size];
+                        _deallocateData();
+                        _data = _allocateData(new_total_size);
                     }
                 }
                 else // allocate space for data
                 {
-                    _data = new value_type[new_total_size];
+                    _data = _allocateData(new_total_size);
                 }
 
                 _layout.stride = sizeof(value_type);
@@ -200,6 +200,7 @@ namespace vsg
             _layout.stride = sizeof(value_type);
             _size = numElements;
             _data = data;
+            _dataAllocation = NEW_ALLOCATION;
             _storage = nullptr;
         }
 
@@ -226,7 +227,7 @@ namespace vsg
         // when the data is stored in a sperate vsg::Data object then return nullptr and do not attempt to release data.
         void* dataRelease() override
         {
-            if (!_storage)
+            if (!_storage && _dataAllocation == NEW_ALLOCATION)
             {
                 void* tmp = _data;
                 _data = nullptr;
@@ -287,9 +288,15 @@ namespace vsg
 
         void _delete()
         {
-            if (!_storage && _data) delete[] _data;
+            if (!_storage && _data) _deallocateData();
         }
 
+        // allocate the data from the Allocator this Array was created with, such as the ArenaAllocator used by BinaryInput, so that data and Array are released together,
+        // otherwise from new[] aligned to Layout::alignment.
+        value_type* _allocateData(std::size_t numValues) { return _allocateValues<value_type>(numValues); }
+
+        void _deallocateData() { _deallocateValues(_data); }
+
     private:
         value_type* _data;
         uint32_t _size;
@@ -44,7 +44,7 @@ namespace vsg
 
         Array2D(uint32_t width, uint32_t height, Layout layout = {}) :
             Data(layout, sizeof(value_type)),
-            _data(new value_type[width * height]),
+            _data(_allocateData(width * height)),
             _width(width),
             _height(height) {}
 
@@ -56,7 +56,7 @@ namespace vsg
 
         Array2D(uint32_t width, uint32_t height, const value_type& value, Layout layout = {}) :
             Data(layout, sizeof(value_type)),
-            _data(new value_type[width * height]),
+            _data(_allocateData(width * height)),
             _width(width),
             _height(height)
         {
@@ -81,6 +81,7 @@ namespace vsg
         std::size_t sizeofObject() const noexcept override { return sizeof(Array2D); }
         const char* className() const noexcept override { return type_name<Array2D>(); }
         const std::type_info& type_info() const noexcept override { return typeid(*this); }
+        bool is_compatible(const std::type_info& type) const noexcept override { return typeid(Array2D) == type ? true : Data::is_compatible(type); }
 
         // implementation provided by Visitor.h
         void accept(Visitor& visitor) override;
@@ -112,15 +113,15 @@ namespace vsg
 
                 if (_data) // if data already may be able to reuse it
                 {
-                    if (original_size != new_size) // if existing data is a different size delete old, and create new
+                    if (original_size != new_size || !_isAligned(_data)) // if existing data is a different size or alignment delete old, and create new
                     {
-                        _delete();
-                        _data = new value_type[new_size];
+                        _deallocateData();
+                        _data = _allocateData(new_size);
                     }
                 }
                 else // allocate space for data
                 {
-                    _data = new value_type[new_size];
+                    _data = _allocateData(new_size);
                 }
 
                 _layout.stride = sizeof(value_type);
@@ -178,6 +179,7 @@ namespace vsg
             _width = width;
             _height = height;
             _data = data;
+            _dataAllocation = NEW_ALLOCATION;
             _storage = nullptr;
         }
 
@@ -205,7 +207,7 @@ namespace vsg
         // release the data so that ownership can be passed on, the local data pointer and size is set to 0 and destruction of Array will no result in the data being deleted.
         void* dataRelease() override
         {
-            if (!_storage)
+            if (!_storage && _dataAllocation == NEW_ALLOCATION)
             {
                 void* tmp = _data;
                 _data = nullptr;
@@ -275,9 +277,14 @@ namespace vsg
 
         void _delete()
         {
-            if (!_storage && _data) delete[] _data;
+            if (!_storage && _data) _deallocateData();
         }
 
+        // allocate the data from the Allocator this array was created with, otherwise from new[] aligned to Layout::alignment.
+        value_type* _allocateData(std::size_t numValues) { return _allocateValues<value_type>(numValues); }
+
+        void _deallocateData() { _deallocateValues(_data); }
+
     private:
         value_type* _data;
         uint32_t _width;
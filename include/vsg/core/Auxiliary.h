@@ -13,9 +13,9 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 </editor-fold> */
 
 #include <vsg/core/Allocator.h>
+#include <vsg/core/ObjectMap.h>
 #include <vsg/core/ref_ptr.h>
 
-#include <map>
 #include <mutex>
 
 namespace vsg
@@ -37,11 +37,15 @@ namespace vsg
         void unref_nodelete() const;
         inline unsigned int referenceCount() const { return _referenceCount.load(); }
 
-        void setObject(const std::string& key, Object* object);
-        Object* getObject(const std::string& key);
-        const Object* getObject(const std::string& key) const;
+        void setObject(const InternedString& key, Object* object);
+        Object* getObject(const InternedString& key);
+        const Object* getObject(const InternedString& key) const;
 
-        using ObjectMap = std::map<std::string, vsg::ref_ptr<Object>>;
+        void setObject(const std::string& key, Object* object) { setObject(InternedString(key), object); }
+        Object* getObject(const std::string& key) { return getObject(InternedString::find(key)); }
+        const Object* getObject(const std::string& key) const { return getObject(InternedString::find(key)); }
+
+        using ObjectMap = vsg::ObjectMap;
         ObjectMap& getObjectMap() { return _objectMap; }
         const ObjectMap& getObjectMap() const { return _objectMap; }
 
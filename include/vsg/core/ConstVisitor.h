@@ -32,6 +32,7 @@ namespace vsg
     class PagedLOD;
     class StateGroup;
     class CullGroup;
+    class BVHGroup;
     class CullNode;
     class MatrixTransform;
     class Geometry;
@@ -206,6 +207,7 @@ namespace vsg
         virtual void apply(const PagedLOD&);
         virtual void apply(const StateGroup&);
         virtual void apply(const CullGroup&);
+        virtual void apply(const BVHGroup&);
         virtual void apply(const CullNode&);
         virtual void apply(const MatrixTransform&);
         virtual void apply(const Geometry&);
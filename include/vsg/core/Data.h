@@ -17,6 +17,9 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 
 #include <vulkan/vulkan.h>
 
+#include <cstddef>
+#include <memory>
+#include <new>
 #include <vector>
 
 namespace vsg
@@ -84,6 +87,7 @@ namespace vsg
             uint8_t blockHeight = 1;
             uint8_t blockDepth = 1;
             uint8_t origin = TOP_LEFT; /// Hint for setting up texture coordinates, bit 0 x/width axis, bit 1 y/height axis, bit 2 z/depth axis. Vulkan origin for images is top left, which is denoted as 0 here.
+            uint8_t alignment = 0;     /// Byte alignment of the data allocated by Array/Array2D/Array3D, such as 16, 32 or 64 for aligned SIMD loads, 0 for the default alignment of new[]. Must be a power of two, other values are ignored.
         };
 
         Data() {}
@@ -155,7 +159,88 @@ namespace vsg
     protected:
         virtual ~Data() {}
 
+        /// allocate memory for the data from the Allocator this Data object was created with, return nullptr if it wasn't created with an Allocator.
+        void* _allocateFromAllocator(std::size_t size);
+
+        /// return memory allocated by _allocateFromAllocator() to the Allocator.
+        void _deallocateFromAllocator(void* ptr, std::size_t size);
+
+        enum DataAllocation : uint8_t
+        {
+            NEW_ALLOCATION = 0, /// allocated with new[], can be passed on by dataRelease()
+            ALLOCATOR_ALLOCATION = 1, /// allocated from the Allocator this Data was created with
+            ALIGNED_ALLOCATION = 2 /// allocated with aligned operator new[] to honour Layout::alignment
+        };
+
+        /// return _layout.alignment if it's a valid alignment, i.e. a power of two, otherwise 0 for the default alignment.
+        std::size_t _validAlignment() const { return (_layout.alignment & (_layout.alignment - 1)) == 0 ? _layout.alignment : 0; }
+
+        /// allocate numValues of T for the data, from the Allocator this Data was created with when possible, otherwise from new[] aligned to _layout.alignment.
+        template<typename T>
+        T* _allocateValues(std::size_t numValues)
+        {
+            std::size_t alignment = _validAlignment();
+            _dataNumValues = numValues;
+
+            if constexpr (std::is_trivially_copyable_v<T>)
+            {
+                if (alignment <= alignof(std::max_align_t))
+                {
+                    if (void* ptr = _allocateFromAllocator(numValues * sizeof(T)))
+                    {
+                        // trivially copyable types are trivially destructible, but may still have a default constructor that initializes them
+                        if constexpr (!std::is_trivially_default_constructible_v<T>) std::uninitialized_default_construct_n(static_cast<T*>(ptr), numValues);
+                        _dataAllocation = ALLOCATOR_ALLOCATION;
+                        return static_cast<T*>(ptr);
+                    }
+                }
+            }
+
+            if (alignment > __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+            {
+                T* ptr = static_cast<T*>(::operator new[](numValues * sizeof(T), std::align_val_t(alignment)));
+                if constexpr (!std::is_trivially_default_constructible_v<T>) std::uninitialized_default_construct_n(ptr, numValues);
+                _dataAllocation = ALIGNED_ALLOCATION;
+                _dataAlignment = static_cast<uint8_t>(alignment);
+                return ptr;
+            }
+
+            _dataAllocation = NEW_ALLOCATION;
+            return new T[numValues];
+        }
+
+        /// return true if ptr meets the alignment requested by _layout.alignment
+        bool _isAligned(const void* ptr) const
+        {
+            std::size_t alignment = _validAlignment();
+            return alignment == 0 || (reinterpret_cast<uintptr_t>(ptr) % alignment) == 0;
+        }
+
+        /// release values allocated by _allocateValues<T>(..), using the number of values recorded at allocation as the _layout, and with it the Array's size(), may since have changed.
+        template<typename T>
+        void _deallocateValues(T* ptr)
+        {
+            if (_dataAllocation == ALLOCATOR_ALLOCATION)
+            {
+                _deallocateFromAllocator(ptr, _dataNumValues * sizeof(T));
+            }
+            else if (_dataAllocation == ALIGNED_ALLOCATION)
+            {
+                if constexpr (!std::is_trivially_destructible_v<T>) std::destroy_n(ptr, _dataNumValues);
+                ::operator delete[](ptr, std::align_val_t(_dataAlignment));
+            }
+            else
+            {
+                delete[] ptr;
+            }
+            _dataAllocation = NEW_ALLOCATION;
+            _dataNumValues = 0;
+        }
+
         Layout _layout;
+        DataAllocation _dataAllocation = NEW_ALLOCATION;
+        uint8_t _dataAlignment = 0;     // alignment used for an ALIGNED_ALLOCATION, kept separately as _layout may be changed after allocation
+        std::size_t _dataNumValues = 0; // number of values allocated by _allocateValues<T>(..), kept separately as _layout may be changed after allocation
     };
     VSG_type_name(vsg::Data);
 
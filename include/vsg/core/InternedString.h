@@ -0,0 +1,76 @@
+#pragma once
+
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2020 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/core/Export.h>
+
+#include <cstdint>
+#include <functional>
+#include <string>
+
+namespace vsg
+{
+
+    /** Handle to a string held in a global, thread safe interning table. Each distinct string is stored once and assigned a unique id,
+     *  so InternedString are compared and hashed by id, and can be used as keys without constructing or comparing std::string.
+     *  A default constructed InternedString is null, has an id of 0 and doesn't match any interned string, including the empty string.
+     *  Interned strings are never removed from the table, so it grows with every distinct string interned, including the meta data keys read by Object::read(),
+     *  use it for the bounded set of names an application uses rather than for arbitrary or generated strings.*/
+    class VSG_DECLSPEC InternedString
+    {
+    public:
+        InternedString() = default;
+
+        /// intern str, adding it to the table if it's not already present
+        explicit InternedString(const std::string& str);
+        explicit InternedString(const char* str);
+
+        /// return the InternedString for str if it has been previously interned, otherwise return a null InternedString, never adds to the table.
+        static InternedString find(const std::string& str);
+
+        /// unique id of the interned string, 0 when null.
+        uint32_t id() const { return _entry ? _entry->id : 0; }
+
+        const std::string& str() const;
+        const char* c_str() const { return str().c_str(); }
+
+        bool valid() const { return _entry != nullptr; }
+        explicit operator bool() const { return valid(); }
+
+        bool operator==(const InternedString& rhs) const { return _entry == rhs._entry; }
+        bool operator!=(const InternedString& rhs) const { return _entry != rhs._entry; }
+        bool operator<(const InternedString& rhs) const { return id() < rhs.id(); }
+
+        struct Entry
+        {
+            std::string str;
+            uint32_t id;
+        };
+
+    protected:
+        explicit InternedString(const Entry* entry) :
+            _entry(entry) {}
+
+        const Entry* _entry = nullptr;
+    };
+
+} // namespace vsg
+
+namespace std
+{
+    template<>
+    struct hash<vsg::InternedString>
+    {
+        std::size_t operator()(const vsg::InternedString& key) const noexcept { return key.id(); }
+    };
+} // namespace std
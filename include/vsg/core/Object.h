@@ -16,6 +16,7 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <string>
 
 #include <vsg/core/Export.h>
+#include <vsg/core/InternedString.h>
 #include <vsg/core/ref_ptr.h>
 #include <vsg/core/type_name.h>
 
@@ -74,46 +75,66 @@ namespace vsg
         virtual void read(Input& input);
         virtual void write(Output& output) const;
 
-        // ref counting methods
+        // ref counting methods, increments are relaxed and decrements acquire/release so all prior writes to the object are visible to its destructor.
         inline void ref() const noexcept { _referenceCount.fetch_add(1, std::memory_order_relaxed); }
         inline void unref() const noexcept
         {
-            if (_referenceCount.fetch_sub(1, std::memory_order_seq_cst) <= 1) _attemptDelete();
+            if (_referenceCount.fetch_sub(1, std::memory_order_acq_rel) <= 1) _attemptDelete();
         }
-        inline void unref_nodelete() const noexcept { _referenceCount.fetch_sub(1, std::memory_order_seq_cst); }
+        inline void unref_nodelete() const noexcept { _referenceCount.fetch_sub(1, std::memory_order_release); }
         inline unsigned int referenceCount() const noexcept { return _referenceCount.load(); }
 
         /// meta data access methods
-        /// wraps the value with a vsg::Value<T> object and then assigns via setObject(key, vsg::Value<T>)
+        /// the std::string key versions look up the InternedString for key, the InternedString key versions avoid constructing a std::string and hashing it on each call
+        /// so should be preferred in frequently called code, i.e. static const InternedString s_key("key"); object->getValue(s_key, value);
+
+        /// wraps the value with a vsg::Value<T> object and then assigns via setObject(key, vsg::Value<T>), reusing the existing vsg::Value<T> if it's only referenced by this object
+        template<typename T>
+        void setValue(const InternedString& key, const T& value);
+
         template<typename T>
-        void setValue(const std::string& key, const T& value);
+        void setValue(const std::string& key, const T& value) { setValue(InternedString(key), value); }
 
         /// specialization of setValue to handle passing c strings
-        void setValue(const std::string& key, const char* value) { setValue(key, value ? std::string(value) : std::string()); }
+        void setValue(const InternedString& key, const char* value) { setValue(key, value ? std::string(value) : std::string()); }
+        void setValue(const std::string& key, const char* value) { setValue(InternedString(key), value); }
 
         /// get specified value type, return false if value associated with key is not assigned or is not the correct type
         template<typename T>
-        bool getValue(const std::string& key, T& value) const;
+        bool getValue(const InternedString& key, T& value) const;
+
+        template<typename T>
+        bool getValue(const std::string& key, T& value) const { return getValue(InternedString::find(key), value); }
 
         /// assign an Object associated with key
-        void setObject(const std::string& key, Object* object);
+        void setObject(const InternedString& key, Object* object);
+        void setObject(const std::string& key, Object* object) { setObject(InternedString(key), object); }
 
         /// get Object associated with key, return nullptr if no object associated with key has been assigned
-        Object* getObject(const std::string& key);
+        Object* getObject(const InternedString& key);
+        Object* getObject(const std::string& key) { return getObject(InternedString::find(key)); }
 
         /// get const Object associated with key, return nullptr if no object associated with key has been assigned
-        const Object* getObject(const std::string& key) const;
+        const Object* getObject(const InternedString& key) const;
+        const Object* getObject(const std::string& key) const { return getObject(InternedString::find(key)); }
 
         /// get object of specified type associated with key, return nullptr if no object associated with key has been assigned
+        template<class T>
+        T* getObject(const InternedString& key) { return dynamic_cast<T*>(getObject(key)); }
+
         template<class T>
         T* getObject(const std::string& key) { return dynamic_cast<T*>(getObject(key)); }
 
         /// get const object of specified type associated with key, return nullptr if no object associated with key has been assigned
+        template<class T>
+        const T* getObject(const InternedString& key) const { return dynamic_cast<const T*>(getObject(key)); }
+
         template<class T>
         const T* getObject(const std::string& key) const { return dynamic_cast<const T*>(getObject(key)); }
 
         /// remove meta object or value associated with key
-        void removeObject(const std::string& key);
+        void removeObject(const InternedString& key);
+        void removeObject(const std::string& key) { removeObject(InternedString::find(key)); }
 
         // Auxiliary object access methods, the optional Auxiliary is used to store meta data and links to Allocator
         Auxiliary* getOrCreateUniqueAuxiliary();
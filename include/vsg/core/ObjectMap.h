@@ -0,0 +1,78 @@
+#pragma once
+
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2020 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/core/InternedString.h>
+#include <vsg/core/Object.h>
+
+#include <array>
+#include <vector>
+
+namespace vsg
+{
+
+    /** Compact key/Object store used for Object meta data. Keys are InternedString so lookups are a linear scan of pointer compares without constructing or comparing std::string,
+     *  and the first inlineCapacity entries are held inline so the common case of a few meta data entries needs no further heap allocation.
+     *  The order of entries is not preserved by erase().*/
+    class VSG_DECLSPEC ObjectMap
+    {
+    public:
+        using value_type = std::pair<InternedString, ref_ptr<Object>>;
+        using iterator = value_type*;
+        using const_iterator = const value_type*;
+
+        static constexpr std::size_t inlineCapacity = 4;
+
+        ObjectMap() = default;
+        ObjectMap(const ObjectMap& rhs) { *this = rhs; }
+
+        ObjectMap& operator=(const ObjectMap& rhs);
+
+        std::size_t size() const { return _size; }
+        bool empty() const { return _size == 0; }
+
+        iterator begin() { return _data(); }
+        iterator end() { return _data() + _size; }
+        const_iterator begin() const { return _data(); }
+        const_iterator end() const { return _data() + _size; }
+
+        iterator find(const InternedString& key)
+        {
+            for (auto itr = begin(); itr != end(); ++itr)
+            {
+                if (itr->first == key) return itr;
+            }
+            return end();
+        }
+
+        const_iterator find(const InternedString& key) const { return const_cast<ObjectMap*>(this)->find(key); }
+
+        /// return the Object associated with key, inserting a null entry if one is not already present.
+        ref_ptr<Object>& operator[](const InternedString& key);
+
+        /// remove the entry associated with key, return true if an entry was removed.
+        bool erase(const InternedString& key);
+
+        void clear();
+
+    protected:
+        value_type* _data() { return _heap.empty() ? _inline.data() : _heap.data(); }
+        const value_type* _data() const { return _heap.empty() ? _inline.data() : _heap.data(); }
+
+        // entries are held in _inline until inlineCapacity is exceeded, after which they are all held in _heap.
+        std::array<value_type, inlineCapacity> _inline;
+        std::vector<value_type> _heap;
+        std::size_t _size = 0;
+    };
+
+} // namespace vsg
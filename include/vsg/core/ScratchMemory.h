@@ -15,11 +15,15 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <vsg/core/Inherit.h>
 
 #include <algorithm>
+#include <cassert>
 
 namespace vsg
 {
-    /** Lightweight allocator for temporary memory such as C structures allocated for Vulkan calls that don't require destruction.*/
-    struct ScratchMemory : public Inherit<Object, ScratchMemory>
+    /** Lightweight allocator for temporary memory such as C structures allocated for Vulkan calls that don't require destruction.
+     *  Allocations are aligned to alignof(T), when a buffer is exhausted a chained buffer of at least double the size is created,
+     *  and on release() the chained buffers are collapsed into a single buffer so that steady state usage never touches the heap.
+     *  Use ScratchMemory::threadLocal() or ScratchMemoryScope to access the calling thread's instance so it can be used safely from multiple threads.*/
+    struct VSG_DECLSPEC ScratchMemory : public Inherit<Object, ScratchMemory>
     {
         uint8_t* buffer = nullptr;
         uint8_t* ptr = nullptr;
@@ -27,6 +31,9 @@ namespace vsg
 
         ref_ptr<ScratchMemory> next;
 
+        /// number of active ScratchMemoryScope on this ScratchMemory, release() is deferred until the outermost scope ends.
+        uint32_t scopeDepth = 0;
+
         explicit ScratchMemory(size_t bufferSize)
         {
             size = bufferSize;
@@ -39,11 +46,21 @@ namespace vsg
             delete[] buffer;
         }
 
-        uint8_t* align(uint8_t* p) const
+        /// return the ScratchMemory associated with the calling thread, created on first use.
+        static ScratchMemory& threadLocal();
+
+        /// return the calling thread's ScratchMemory for allocations handed back to a caller, such as by Descriptor::assignTo(..).
+        /// The allocations are only released when the caller's ScratchMemoryScope ends, without one the thread's ScratchMemory would grow without limit, so assert that there's an active scope.
+        static ScratchMemory& threadLocalInScope()
+        {
+            auto& memory = threadLocal();
+            assert(memory.scopeDepth > 0 && "ScratchMemory::threadLocalInScope() called without an active ScratchMemoryScope");
+            return memory;
+        }
+
+        static uint8_t* align(uint8_t* p, size_t alignment)
         {
-            auto alignment = sizeof(p);
-            uint8_t* new_p = reinterpret_cast<uint8_t*>(((reinterpret_cast<size_t>(p) + alignment - 1) / alignment) * alignment);
-            return new_p;
+            return reinterpret_cast<uint8_t*>(((reinterpret_cast<size_t>(p) + alignment - 1) / alignment) * alignment);
         }
 
         template<typename T>
@@ -51,26 +68,61 @@ namespace vsg
         {
             size_t allocate_size = sizeof(T) * num;
 
-            if ((ptr + allocate_size) <= (buffer + size))
+            uint8_t* aligned_ptr = align(ptr, alignof(T));
+            if (static_cast<size_t>(aligned_ptr - buffer) + allocate_size <= size)
             {
-                T* allocated_ptr = reinterpret_cast<T*>(ptr);
-
-                // move the ptr to the alignment end
-                ptr = align(ptr + allocate_size);
-
-                return allocated_ptr;
+                ptr = aligned_ptr + allocate_size;
+                return reinterpret_cast<T*>(aligned_ptr);
             }
 
-            if (!next) next = new ScratchMemory(std::max(size, allocate_size));
+            // grow geometrically so the number of chained buffers, and their collapse on release, stays logarithmic.
+            if (!next) next = ScratchMemory::create(std::max(size * 2, allocate_size + alignof(T)));
 
             return next->allocate<T>(num);
         }
 
+        /// total size of this and any chained buffers.
+        size_t totalSize() const { return next ? size + next->totalSize() : size; }
+
         void release()
         {
+            if (next)
+            {
+                // collapse the chained buffers into one buffer large enough for all the allocations made since the last release.
+                size_t new_size = totalSize();
+                next = {};
+
+                delete[] buffer;
+                buffer = new uint8_t[new_size];
+                size = new_size;
+            }
             ptr = buffer;
-            if (next) next->release();
         }
     };
+    VSG_type_name(vsg::ScratchMemory);
+
+    /** Provides access to the calling thread's ScratchMemory for the duration of a scope, releasing all the allocations made when the outermost ScratchMemoryScope ends.
+     *  Functions that fill in Vulkan structs for a caller, such as Descriptor::assignTo(..), should allocate from ScratchMemory::threadLocalInScope() and leave the scope to the caller.*/
+    struct ScratchMemoryScope
+    {
+        ScratchMemoryScope() :
+            memory(ScratchMemory::threadLocal())
+        {
+            ++memory.scopeDepth;
+        }
+
+        ScratchMemoryScope(const ScratchMemoryScope&) = delete;
+        ScratchMemoryScope& operator=(const ScratchMemoryScope&) = delete;
+
+        ~ScratchMemoryScope()
+        {
+            if (--memory.scopeDepth == 0) memory.release();
+        }
+
+        template<typename T>
+        T* allocate(size_t num = 1) { return memory.allocate<T>(num); }
+
+        ScratchMemory& memory;
+    };
 
 } // namespace vsg
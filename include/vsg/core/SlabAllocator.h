@@ -0,0 +1,98 @@
+#pragma once
+
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2020 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/core/Allocator.h>
+
+#include <array>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace vsg
+{
+
+    /// Size class slab Allocator for scene graph objects.
+    /// Allocations up to maxSlabAllocationSize are rounded up to a multiple of alignment and carved out of slabs of slabSize bytes, each slab serving a single size class recorded in a header at the start of the slab.
+    /// Slabs are aligned to slabSize so the slab, and with it the size class, of a block is found directly from the block's address.
+    /// Freed blocks are placed on the size class's free list for reuse, the slabs themselves are only released when the SlabAllocator is destroyed,
+    /// so creating an SlabAllocator per tile and creating the tile's objects with it releases the whole subgraph's memory in bulk once the last object that references the allocator is deleted.
+    /// To reduce contention each thread allocates from one of a set of arenas, each with its own mutex, slabs and free lists.
+    class VSG_DECLSPEC SlabAllocator : public Allocator
+    {
+    public:
+        /// in_slabSize is rounded up to a power of two, numArenas of 0 uses one arena per hardware thread.
+        explicit SlabAllocator(std::size_t in_slabSize = 65536, uint32_t numArenas = 0);
+
+        std::size_t sizeofObject() const noexcept override { return sizeof(SlabAllocator); }
+
+        static constexpr std::size_t alignment = 16;
+        static constexpr std::size_t maxSlabAllocationSize = 1024;
+        static constexpr std::size_t numSizeClasses = maxSlabAllocationSize / alignment;
+
+        const std::size_t slabSize;
+
+        void* allocate(std::size_t n, const void* hint) override;
+
+        void* allocate(std::size_t size) override;
+
+        /// size is used to distinguish slab blocks from allocations larger than maxSlabAllocationSize, so must be on the same side of maxSlabAllocationSize as the size passed to allocate().
+        /// The size class is read from the block's slab header rather than computed from size, and a size of 0 looks up whether ptr is from one of the slabs.
+        void deallocate(const void* ptr, std::size_t size = 0) override;
+
+        /// number of slabs allocated across all the arenas
+        std::size_t numSlabs() const;
+
+        /// total bytes reserved by the slabs
+        std::size_t bytesReserved() const { return numSlabs() * slabSize; }
+
+    protected:
+        virtual ~SlabAllocator();
+
+        // stored at the start of each slab, blocks start at the next multiple of alignment
+        struct SlabHeader
+        {
+            std::size_t sizeClass = 0;
+        };
+
+        struct FreeBlock
+        {
+            FreeBlock* next = nullptr;
+        };
+
+        struct SizeClass
+        {
+            FreeBlock* freeList = nullptr;
+            uint8_t* current = nullptr; // next unused block in the size class's latest slab
+            uint8_t* end = nullptr;
+        };
+
+        struct alignas(64) Arena
+        {
+            mutable std::mutex mutex;
+            std::array<SizeClass, numSizeClasses> sizeClasses;
+            std::vector<void*> slabs;
+        };
+
+        Arena& _arena();
+
+        const SlabHeader* _slabHeader(const void* ptr) const;
+
+        /// return true if ptr is from one of the slabs, requires locking and searching each arena so is only used when deallocate() isn't passed a size.
+        bool _isSlabBlock(const void* ptr) const;
+
+        uint32_t _numArenas;
+        std::unique_ptr<Arena[]> _arenas;
+    };
+
+} // namespace vsg
@@ -119,20 +119,29 @@ namespace vsg
     };
 
     template<typename T>
-    void Object::setValue(const std::string& key, const T& value)
+    void Object::setValue(const InternedString& key, const T& value)
     {
         using ValueT = Value<T>;
-        setObject(key, new ValueT(value));
+        Object* object = getObject(key);
+        if (object && object->referenceCount() == 1 && (typeid(*object) == typeid(ValueT)))
+        {
+            // no one else holds the existing Value<T> so update it in place rather than allocate a new one.
+            static_cast<ValueT*>(object)->set(value);
+        }
+        else
+        {
+            setObject(key, new ValueT(value));
+        }
     }
 
     template<typename T>
-    bool Object::getValue(const std::string& key, T& value) const
+    bool Object::getValue(const InternedString& key, T& value) const
     {
         using ValueT = Value<T>;
         const Object* object = getObject(key);
         if (object && (typeid(*object) == typeid(ValueT)))
         {
-            const ValueT* vo = static_cast<const ValueT*>(getObject(key));
+            const ValueT* vo = static_cast<const ValueT*>(object);
             value = *vo;
             return true;
         }
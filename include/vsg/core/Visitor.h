@@ -32,6 +32,7 @@ namespace vsg
     class PagedLOD;
     class StateGroup;
     class CullGroup;
+    class BVHGroup;
     class CullNode;
     class MatrixTransform;
     class Geometry;
@@ -206,6 +207,7 @@ namespace vsg
         virtual void apply(PagedLOD&);
         virtual void apply(StateGroup&);
         virtual void apply(CullGroup&);
+        virtual void apply(BVHGroup&);
         virtual void apply(CullNode&);
         virtual void apply(MatrixTransform&);
         virtual void apply(Geometry&);
@@ -18,6 +18,7 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <vsg/io/Options.h>
 
 #include <fstream>
+#include <vector>
 
 namespace vsg
 {
@@ -63,8 +64,17 @@ namespace vsg
         // read object
         vsg::ref_ptr<vsg::Object> read() override;
 
+        /// read the class name index written by BinaryOutput::_writeClassName(..), adding the class name that follows a new index to the class name table. Returns a null InternedString for nullptr.
+        InternedString _readClassName();
+
+        /// Allocator used to create the objects read, assigned an ArenaAllocator when Options::arenaAllocation is set, null to create objects on the heap.
+        ref_ptr<Allocator> allocator;
+
     protected:
         std::istream& _input;
+
+        // class name table, indexed by the file's class name index - 1.
+        std::vector<InternedString> _classNames;
     };
 
 } // namespace vsg
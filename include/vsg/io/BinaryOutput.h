@@ -16,6 +16,7 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <vsg/io/Output.h>
 
 #include <fstream>
+#include <unordered_map>
 
 namespace vsg
 {
@@ -61,8 +62,14 @@ namespace vsg
         /// write object
         void write(const vsg::Object* object) override;
 
+        /// write the index of className in the file's class name table, followed by className itself the first time it's written. Index 0 is reserved for nullptr.
+        void _writeClassName(const char* className);
+
     protected:
         std::ostream& _output;
+
+        // class name table, keyed by the className() pointer as each class returns the same type_name<T>() string.
+        std::unordered_map<const char*, uint32_t> _classNameIndices;
     };
 
 } // namespace vsg
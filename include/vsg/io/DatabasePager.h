@@ -20,11 +20,16 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <vsg/nodes/PagedLOD.h>
 
 #include <vsg/threading/ActivityStatus.h>
+#include <vsg/threading/Affinity.h>
 
 #include <vsg/traversals/CompileTraversal.h>
 
+#include <vsg/ui/UIEvent.h>
+
+#include <array>
 #include <condition_variable>
 #include <list>
+#include <map>
 #include <thread>
 
 namespace vsg
@@ -49,12 +54,88 @@ namespace vsg
         std::vector<const PagedLOD*> newHighresRequired;
     };
 
+    /// Lock free histogram of durations, bucket i counts durations from 2^(i-1) up to 2^i microseconds, with bucket 0 counting durations below 1 microsecond.
+    struct VSG_DECLSPEC LatencyHistogram
+    {
+        static constexpr std::size_t numBuckets = 32;
+
+        std::array<std::atomic_uint64_t, numBuckets> buckets{};
+        std::atomic_uint64_t count{0};
+        std::atomic_uint64_t totalMicroseconds{0};
+        std::atomic_uint64_t maximumMicroseconds{0};
+
+        void add(clock::duration duration);
+
+        /// average duration in milliseconds.
+        double average() const;
+
+        /// upper bound in milliseconds of the bucket containing the specified ratio (0.0 to 1.0) of the durations recorded, i.e. percentile(0.95) for the 95th percentile.
+        double percentile(double ratio) const;
+
+        void reset();
+    };
+
+    /// Runtime statistics of the DatabasePager, updated by the pager threads using atomics so they can be read each frame from any thread without locking.
+    class VSG_DECLSPEC DatabasePagerStats : public Inherit<Object, DatabasePagerStats>
+    {
+    public:
+        DatabasePagerStats();
+
+        // queue depths, sampled at the start of each DatabasePager::updateSceneGraph()
+        std::atomic_uint32_t requestQueueSize{0};
+        std::atomic_uint32_t compileQueueSize{0};
+        std::atomic_uint32_t mergeQueueSize{0};
+
+        // latencies of each paging stage
+        LatencyHistogram requestToRead;    // waiting in the request queue
+        LatencyHistogram read;             // reading the file
+        LatencyHistogram readToCompile;    // waiting in the compile queue and for the CompileTraversal to become available
+        LatencyHistogram compile;          // compiling the subgraph
+        LatencyHistogram compileToMerge;   // waiting for transfer completion and the merge in updateSceneGraph()
+        LatencyHistogram requestToMerge;   // total time from request to merge
+
+        // running totals
+        std::atomic_uint64_t numRequests{0};
+        std::atomic_uint64_t numRead{0};
+        std::atomic_uint64_t numCompiled{0};
+        std::atomic_uint64_t numMerged{0};
+        std::atomic_uint64_t numDiscarded{0}; // requests dropped before merging as the high res child was no longer required
+        std::atomic_uint64_t numExpired{0};   // merged subgraphs removed to keep within the DatabasePager's count and memory budgets
+        std::atomic_uint64_t numHighResMissing{0}; // times RecordTraversal found a visible PagedLOD high res child that wasn't yet loaded
+        std::atomic_uint64_t numCoalescedReads{0}; // requests served by another PagedLOD's read of the same file
+        std::atomic_uint64_t bytesRead{0}; // only measured when measureBytesRead is enabled
+        std::atomic_uint64_t bytesCompiled{0};
+
+        // rates averaged over at least rateInterval seconds, updated by updateSceneGraph()
+        std::atomic<double> bytesReadPerSecond{0.0};
+        std::atomic<double> compilesPerSecond{0.0};
+        double rateInterval = 1.0;
+
+        /// measure bytesRead and bytesReadPerSecond, disabled by default as it requires an extra file search and stat for every file read.
+        bool measureBytesRead = false;
+
+        /// update the queue sizes and rates, called by DatabasePager::updateSceneGraph().
+        void update(time_point time, uint32_t numRequestsQueued, uint32_t numCompilesQueued, uint32_t numMergesQueued);
+
+        void reset();
+
+        void print(std::ostream& out) const;
+
+    protected:
+        time_point _rateStartTime;
+        uint64_t _rateStartBytesRead = 0;
+        uint64_t _rateStartNumCompiled = 0;
+    };
+    VSG_type_name(vsg::DatabasePagerStats);
+
+    /// Thread safe queue of PagedLOD, ordered so that take_when_available() returns the PagedLOD with the highest PagedLOD::priority.
+    /// Uses an indexed max heap, with each PagedLOD's position in the heap stored in PagedLOD::queueIndex, so that take and updatePriority are O(log n).
     class VSG_DECLSPEC DatabaseQueue : public Inherit<Object, DatabaseQueue>
     {
     public:
         DatabaseQueue(ref_ptr<ActivityStatus> status);
 
-        using Nodes = std::list<ref_ptr<PagedLOD>>;
+        using Nodes = std::vector<ref_ptr<PagedLOD>>;
 
         ActivityStatus* getStatus() { return _status; }
         const ActivityStatus* getStatus() const { return _status; }
@@ -66,24 +147,59 @@ namespace vsg
 
         void add(Nodes& nodes);
 
+        /// reposition the plod in the queue to reflect an increase in its PagedLOD::priority, ignored if the plod is not in this queue.
+        void updatePriority(const PagedLOD* plod);
+
+        /// remove and return the highest priority PagedLOD without waiting, return null if the queue is empty.
+        ref_ptr<PagedLOD> take();
+
+        /// remove and return the highest priority PagedLOD, parking the calling thread till one is available, return null if the status has been cancelled.
         ref_ptr<PagedLOD> take_when_available();
 
+        /// remove and return all the PagedLOD, parking the calling thread till at least one is available, return empty if the status has been cancelled.
         Nodes take_all_when_available();
 
-        Nodes take_all()
+        /// remove and return the highest priority numShares'th share of the PagedLOD, at least one and at most maxNumNodes (0 for no limit), parking the calling thread till at least one is available.
+        /// Wakes another waiting thread if PagedLOD remain so that a burst of requests is spread across the threads taking from the queue, return empty if the status has been cancelled.
+        Nodes take_share_when_available(uint32_t numShares, uint32_t maxNumNodes = 0);
+
+        Nodes take_all();
+
+        /// remove and return all the PagedLOD whose high res child is no longer required at the specified frame, see PagedLOD::highResRequired().
+        Nodes take_stale(uint64_t frameCount);
+
+        /// remove and return all the PagedLOD compiled in the same batch, identified by sharing the specified PagedLOD::semaphore.
+        Nodes take_batch(const Semaphore* semaphore);
+
+        /// wake all threads waiting in take_when_available() or take_all_when_available() so they can check the ActivityStatus, call after cancelling the status.
+        void release();
+
+        size_t size() const
         {
             std::scoped_lock lock(_mutex);
-            Nodes nodes;
-            nodes.swap(_queue);
-            return nodes;
+            return _heap.size();
         }
 
     protected:
         virtual ~DatabaseQueue();
 
-        std::mutex _mutex;
+        struct Entry
+        {
+            double priority = 0.0;
+            ref_ptr<PagedLOD> plod;
+        };
+
+        // heap helper methods, calling thread must hold _mutex.
+        void _push(ref_ptr<PagedLOD> plod);
+        ref_ptr<PagedLOD> _pop();
+        Nodes _take_all();
+        void _moveUp(uint32_t pos);
+        void _moveDown(uint32_t pos);
+        void _assign(uint32_t pos, Entry&& entry);
+
+        mutable std::mutex _mutex;
         std::condition_variable _cv;
-        Nodes _queue;
+        std::vector<Entry> _heap;
         ref_ptr<ActivityStatus> _status;
     };
     VSG_type_name(vsg::DatabaseQueue);
@@ -96,10 +212,18 @@ namespace vsg
         DatabasePager(const DatabasePager&) = delete;
         DatabasePager& operator=(const DatabasePager& rhs) = delete;
 
+        /// start the read and compile threads, numReadThreads, numCompileThreads and numCompileTraversalsPerThread should be set before calling start().
+        /// If no compileTraversal is assigned the subgraphs read are merged without compiling, only suitable for CPU only traversals.
         virtual void start();
 
+        /// return true if start() has been called and the read and compile threads are running.
+        bool started() const { return !_readThreads.empty() || !_compileThreads.empty(); }
+
         virtual void request(ref_ptr<PagedLOD> plod);
 
+        /// notify the DatabasePager that PagedLOD::priority of an already requested plod has been increased.
+        virtual void updatePriority(const PagedLOD* plod);
+
         virtual void updateSceneGraph(FrameStamp* frameStamp);
 
         using Semaphores = std::set<ref_ptr<Semaphore>>;
@@ -112,10 +236,62 @@ namespace vsg
         std::atomic_uint numActiveRequests{0};
         std::atomic_uint64_t frameCount;
 
+        /// incremented by updateSceneGraph() whenever it merges or expires a subgraph, so caches of per node results such as CullCache can discard results that may refer to removed nodes.
+        std::atomic_uint64_t sceneGraphModifiedCount{0};
+
         ref_ptr<CulledPagedLODs> culledPagedLODs;
 
+        /// paging statistics, safe to read from any thread.
+        ref_ptr<DatabasePagerStats> stats;
+
         uint32_t targetMaxNumPagedLODWithHighResSubgraphs = 10000;
 
+        /// memory budgets in bytes for merged high res subgraphs, once exceeded inactive PagedLOD are expired in least recently used order. 0 for no limit.
+        VkDeviceSize targetMaxHostMemory = 0;
+        VkDeviceSize targetMaxDeviceMemory = 0;
+
+        /// current bytes of host memory held by the Data of the merged high res subgraphs and of device memory reserved for them during compile, staging memory returned to the pool after upload isn't included.
+        std::atomic_uint64_t hostMemoryInUse{0};
+        std::atomic_uint64_t deviceMemoryInUse{0};
+
+        /// number of threads reading PagedLOD subgraphs from file
+        uint32_t numReadThreads = 4;
+
+        /// number of threads compiling PagedLOD subgraphs, each has its own CommandPool, MemoryBufferPools and set of CompileTraversals.
+        /// All compile threads submit their transfers to the CompileTraversal's graphicsQueue. With more than one compile thread objects shared between subgraphs (e.g. via Options::objectCache)
+        /// are compiled once under a ConcurrentCompile::Lock, and a batch that uses a shared object whose transfers are submitted by another thread's batch is merged in the same frame as that batch or after it.
+        uint32_t numCompileThreads = 1;
+
+        /// maximum number of PagedLOD a compile thread takes from the compile queue for each batch it compiles. 0 takes an equal share of the queued PagedLOD for each compile thread.
+        uint32_t maxNumCompilesPerBatch = 0;
+
+        /// CPU affinity applied by each read thread when it starts, an empty Affinity leaves the threads unpinned.
+        Affinity readThreadAffinity;
+
+        /// CPU affinity applied by each compile thread when it starts, before it creates its CommandPool and MemoryBufferPools so that with Affinity::memoryNode set they're allocated from that NUMA node.
+        Affinity compileThreadAffinity;
+
+        /// number of CompileTraversals each compile thread cycles through so that compiles can proceed while earlier transfers are still in use.
+        uint32_t numCompileTraversalsPerThread = 16;
+
+        /// maximum time in milliseconds that updateSceneGraph() should spend on the active list sweep and merging, 0.0 for no limit.
+        double maxUpdateSceneGraphTime = 0.0;
+
+        /// maximum number of activeList entries updateSceneGraph() checks for becoming inactive, the sweep resumes from the same point next frame. 0 for no limit.
+        uint32_t maxNumActiveChecksPerFrame = 0;
+
+        /// maximum number of compiled subgraphs updateSceneGraph() merges, remaining subgraphs are merged in priority order on later frames. Subgraphs compiled in the same batch share a semaphore so are always merged together, even if this exceeds the limit. 0 for no limit.
+        uint32_t maxNumMergesPerFrame = 0;
+
+        /// enable predictive prefetch, RecordTraversal extrapolates the camera motion from recent frames and requests PagedLOD high res subgraphs that will become visible, with lower priority than visible ones.
+        bool predictivePrefetch = false;
+
+        /// time in seconds ahead of the current frame that the camera position is extrapolated to for predictive prefetch.
+        double prefetchLookAheadTime = 0.5;
+
+        /// number of recent frames used to estimate the camera velocity for predictive prefetch.
+        uint32_t prefetchNumFramesToSample = 4;
+
         std::mutex pendingPagedLODMutex;
 
         ref_ptr<PagedLODContainer> pagedLODContainer;
@@ -125,16 +301,53 @@ namespace vsg
 
         void requestDiscarded(PagedLOD* plod);
 
+        /// register a read request with the coalesced reads, returns true if plod should be read, false if it has been attached to an existing read of the same filename and options.
+        bool coalesceRead(ref_ptr<PagedLOD> plod);
+
+        /// discard the requests waiting on plod's read if the read failed, otherwise they continue waiting till plod's subgraph has been compiled.
+        void readCompleted(PagedLOD* plod, ref_ptr<Node> subgraph);
+
+        /// pass the subgraph read and compiled by plod on to the requests that were waiting on the same file, appending those still required to nodesToMerge.
+        void compileCompleted(PagedLOD* plod, DatabaseQueue::Nodes& nodesToMerge);
+
+        /// discard a read or compile request, handing the read on to the next waiting request for the same file that is still required.
+        void readDiscarded(ref_ptr<PagedLOD> plod);
+
         ref_ptr<ActivityStatus> _status;
 
         ref_ptr<DatabaseQueue> _requestQueue;
         ref_ptr<DatabaseQueue> _compileQueue;
         ref_ptr<DatabaseQueue> _toMergeQueue;
 
+        uint32_t _activeListSweepIndex = 0;
+
+        // read requests for the same filename and options from multiple PagedLOD share a single read and compile, the first request reads and compiles the file while later ones wait to be merged with its result.
+        struct CoalescedRead
+        {
+            ref_ptr<PagedLOD> leader;
+            DatabaseQueue::Nodes followers;
+        };
+        using CoalescedReadKey = std::pair<Path, const Options*>;
+        std::mutex _coalescedReadsMutex;
+        std::map<CoalescedReadKey, CoalescedRead> _coalescedReads;
+
+        // number of merged PagedLOD holding each high res subgraph, coalesced reads share one subgraph so its memory is added to hostMemoryInUse/deviceMemoryInUse by the first holder merged and removed when the last holder expires. Only accessed from updateSceneGraph().
+        std::map<const Node*, uint32_t> _subgraphHolders;
+
         std::list<std::thread> _readThreads;
         std::list<std::thread> _compileThreads;
 
         Semaphores _semaphores;
+
+        /// append the batches that the compiled PagedLOD in nodes depend on, return false if any have transfers yet to be submitted or have been deferred to a later frame so nodes can't be merged this frame.
+        bool _takeMergeDependencies(DatabaseQueue::Nodes& nodes, const std::set<const Semaphore*>& deferred);
+
+        // shared by the compile threads when numCompileThreads > 1
+        ref_ptr<ConcurrentCompile> _concurrentCompile;
+
+        // semaphores of other batches that a compiled PagedLOD's subgraph depends on, see Context::compileDependencies.
+        std::mutex _mergeDependenciesMutex;
+        std::map<const PagedLOD*, Semaphores> _mergeDependencies;
     };
     VSG_type_name(vsg::DatabasePager);
 
@@ -30,6 +30,9 @@ namespace vsg
 
     extern VSG_DECLSPEC bool fileExists(const Path& path);
 
+    /// return the size of the file in bytes, or 0 if the file doesn't exist.
+    extern VSG_DECLSPEC uint64_t fileSize(const Path& path);
+
     extern VSG_DECLSPEC Path filePath(const Path& path);
 
     extern VSG_DECLSPEC Path fileExtension(const Path& path);
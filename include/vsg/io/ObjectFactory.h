@@ -15,8 +15,11 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <vsg/core/Object.h>
 #include <vsg/core/type_name.h>
 
+#include <atomic>
 #include <functional>
 #include <map>
+#include <mutex>
+#include <vector>
 
 namespace vsg
 {
@@ -28,26 +31,82 @@ namespace vsg
 
         virtual vsg::ref_ptr<vsg::Object> create(const std::string& className);
 
+        /// create an object of the specified class in memory provided by the allocator, falling back to create(className) if allocator is null or the class has no CreateWithAllocatorFunction registered.
+        virtual vsg::ref_ptr<vsg::Object> create(const std::string& className, Allocator* allocator);
+
+        /// create an object of the interned className, the create functions are found by indexing with className.id() rather than a string compare walk of the CreateMap.
+        /// Classes not found that way, and all classes when called on a subclass of ObjectFactory, are created by create(className.str(), allocator) so its overrides are still used.
+        virtual vsg::ref_ptr<vsg::Object> create(const InternedString& className, Allocator* allocator = nullptr);
+
         using CreateFunction = std::function<vsg::ref_ptr<vsg::Object>()>;
         using CreateMap = std::map<std::string, CreateFunction>;
 
-        CreateMap& getCreateMap() { return _createMap; }
+        /// return the CreateMap for modification, marking the functions used by create(const InternedString&, ..) to be rebuilt from the maps on its next call.
+        CreateMap& getCreateMap()
+        {
+            _typeFunctionsDirty = true;
+            return _createMap;
+        }
         const CreateMap& getCreateMap() const { return _createMap; }
 
+        using CreateWithAllocatorFunction = std::function<vsg::ref_ptr<vsg::Object>(Allocator*)>;
+        using CreateWithAllocatorMap = std::map<std::string, CreateWithAllocatorFunction>;
+
+        /// return the CreateWithAllocatorMap for modification, marking the functions used by create(const InternedString&, ..) to be rebuilt from the maps on its next call.
+        CreateWithAllocatorMap& getCreateWithAllocatorMap()
+        {
+            _typeFunctionsDirty = true;
+            return _createWithAllocatorMap;
+        }
+        const CreateWithAllocatorMap& getCreateWithAllocatorMap() const { return _createWithAllocatorMap; }
+
+        /// register the functions for creating instances of className, replacing any previously registered.
+        void add(const std::string& className, CreateFunction createFunction, CreateWithAllocatorFunction createWithAllocatorFunction = {});
+
         /// return the ObjectFactory singleton instance
         static ref_ptr<ObjectFactory>& instance();
 
     protected:
         CreateMap _createMap;
+        CreateWithAllocatorMap _createWithAllocatorMap;
+
+        struct TypeFunctions
+        {
+            CreateFunction create;
+            CreateWithAllocatorFunction createWithAllocator;
+        };
+
+        /// return the functions registered for className, rebuilding _typeFunctions from the maps if they have been modified since it was last built, or nullptr if none are registered.
+        const TypeFunctions* _findTypeFunctions(const InternedString& className);
+
+        /// rebuild _typeFunctions from the maps.
+        void _updateTypeFunctions();
+
+        // indexed by the InternedString::id() of the class name, holding copies of the functions in the maps.
+        std::vector<TypeFunctions> _typeFunctions;
+        std::atomic_bool _typeFunctionsDirty{false};
+        std::mutex _typeFunctionsMutex;
+
+        // sizes of the maps when _typeFunctions was last built, so classes added through a previously returned map reference are picked up on a miss.
+        std::size_t _typeFunctionsCreateMapSize = 0;
+        std::size_t _typeFunctionsCreateWithAllocatorMapSize = 0;
     };
 
+    // Helper template function for creating an Object of specified T using an Allocator, the Allocator type is a template parameter so that it only needs to be a complete type where used.
+    template<class T, class A>
+    ref_ptr<Object> createWithAllocator(A* allocator)
+    {
+        return ref_ptr<Object>(allocator->template createObject<T>());
+    }
+
     // Helper tempalte class for registering the ability to create a Object of specified T on deamnd.
     template<class T>
     struct RegisterWithObjectFactoryProxy
     {
         RegisterWithObjectFactoryProxy()
         {
-            ObjectFactory::instance()->getCreateMap()[type_name<T>()] = []() { return T::create(); };
+            ObjectFactory::instance()->add(
+                type_name<T>(), []() { return T::create(); }, [](Allocator* allocator) { return createWithAllocator<T>(allocator); });
         }
     };
 
@@ -43,6 +43,9 @@ namespace vsg
         ref_ptr<OperationThreads> operationThreads;
         Paths paths;
 
+        /// when true BinaryInput places all the objects, and the data of the Arrays, read from a file into a single ArenaAllocator, so that reading a file makes a handful of large allocations and releasing the subgraph frees them together.
+        bool arenaAllocation = false;
+
     protected:
         virtual ~Options();
     };
@@ -23,8 +23,11 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #    pragma clang diagnostic ignored "-Wnested-anon-types"
 #endif
 
+#include <vsg/core/Export.h>
 #include <vsg/maths/sphere.h>
 
+#include <cstdint>
+
 namespace vsg
 {
     /** plane template class representing the plane in Hessian Normal Form : n.x = -p.*/
@@ -134,6 +137,42 @@ namespace vsg
     {
         return intersect(polytope.begin(), polytope.end(), s);
     }
+
+    /** return true if bounding sphere is wholly or partially intersects with convex polytope, testing the planes starting from planeIndex.
+     * When the sphere is rejected planeIndex is set to the rejecting plane, so passing it back in for the next test of the same sphere tests the plane most likely to reject it first (plane-coherency).*/
+    template<class Polytope, typename T, typename I>
+    constexpr bool intersect(const Polytope& polytope, const t_sphere<T>& s, I& planeIndex)
+    {
+        auto negative_radius = -s.radius;
+        const I numPlanes = static_cast<I>(polytope.size());
+        if (planeIndex >= numPlanes) planeIndex = 0;
+        for (I i = planeIndex; i < numPlanes; ++i)
+        {
+            if (distance(polytope[i], s.center) < negative_radius)
+            {
+                planeIndex = i;
+                return false;
+            }
+        }
+        for (I i = 0; i < planeIndex; ++i)
+        {
+            if (distance(polytope[i], s.center) < negative_radius)
+            {
+                planeIndex = i;
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /** batch test of numSpheres float bounding spheres against a convex polytope of numPlanes planes, with the spheres tested several at a time using SSE when available.
+     * visible[i] is set to 1 when spheres[i] wholly or partially intersects the polytope, 0 otherwise. Returns the number of visible spheres.*/
+    extern VSG_DECLSPEC std::size_t intersect(const plane* planes, std::size_t numPlanes, const sphere* spheres, std::size_t numSpheres, uint8_t* visible);
+
+    /** batch test of numSpheres double bounding spheres against a convex polytope of numPlanes planes, with the spheres tested several at a time using AVX or SSE2 when available.
+     * visible[i] is set to 1 when spheres[i] wholly or partially intersects the polytope, 0 otherwise. Returns the number of visible spheres.*/
+    extern VSG_DECLSPEC std::size_t intersect(const dplane* planes, std::size_t numPlanes, const dsphere* spheres, std::size_t numSpheres, uint8_t* visible);
+
 } // namespace vsg
 
 #if defined(__clang__)
@@ -131,7 +131,7 @@ namespace vsg
     /// fast float matrix inversion that use assumes the matrix is composed of only scales, rotations and translations forming a 4x3 matrix.
     extern VSG_DECLSPEC mat4 inverse_4x3(const mat4& m);
 
-    /// fast double matrix inversion that use assumes the matrix is composed of only scales, rotations and translations forming a 4x3 matrix.
+    /// fast double matrix inversion that use assumes the matrix is composed of only scales, rotations and translations forming a 4x3 matrix, uses AVX2 when available.
     extern VSG_DECLSPEC dmat4 inverse_4x3(const dmat4& m);
 
     /// general purpose 4x4 float matrix inversion.
@@ -146,6 +146,18 @@ namespace vsg
     /// double matrix inversion with automatic selection of inverse_4x3 when appropriate, otherwise uses inverse_4x4
     extern VSG_DECLSPEC dmat4 inverse(const dmat4& m);
 
+    /// transform count float vertices, equivalent to out[i] = matrix * in[i], uses SSE when available. in and out may be the same array.
+    extern VSG_DECLSPEC void transform(const mat4& matrix, const vec3* in, vec3* out, std::size_t count);
+
+    /// transform count double vertices, equivalent to out[i] = matrix * in[i], uses AVX or SSE2 when available. in and out may be the same array.
+    extern VSG_DECLSPEC void transform(const dmat4& matrix, const dvec3* in, dvec3* out, std::size_t count);
+
+    /// split a double vertex into high and low float parts, where high + low represents the double vertex to around 48 bits of precision. Used for relative-to-eye rendering, see MatrixStack::relativeToEye.
+    extern VSG_DECLSPEC void split(const dvec3& in, vec3& high, vec3& low);
+
+    /// split count double vertices into high and low float parts, equivalent to split(in[i], high[i], low[i]).
+    extern VSG_DECLSPEC void split(const dvec3* in, vec3* high, vec3* low, std::size_t count);
+
     /// compute the bounding sphere that encploses a frustum defined by specified float ModelViewMatrixProjection
     extern VSG_DECLSPEC sphere computeFrustumBound(const mat4& m);
 
@@ -0,0 +1,96 @@
+#pragma once
+
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2020 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/maths/sphere.h>
+#include <vsg/nodes/Group.h>
+
+namespace vsg
+{
+
+    /** BVHGroup is a Group that maintains a bounding volume hierarchy over the bounds of its children, so that the RecordTraversal and Intersector can cull
+     *  whole cells of children at a time rather than testing each child in turn, making culling cost logarithmic rather than linear in the number of children.
+     *  build() sorts the children so that each leaf cell of the hierarchy references a contiguous range of children, so should be called once all the children have been added,
+     *  either when creating a scene graph offline or after loading. Children without a valid bound and any children appended after build() are always traversed.
+     *  The cells reference children by index, so any other change to the children, such as inserting, removing, reordering or replacing a child or changing a child's bound, requires build() to be called again.
+     *  read() validates the cells against the children and discards the hierarchy if they don't match, in which case all children are traversed until build() is called.*/
+    class VSG_DECLSPEC BVHGroup : public Inherit<Group, BVHGroup>
+    {
+    public:
+        BVHGroup(Allocator* allocator = nullptr);
+
+        /// cell of the hierarchy, leaf cells reference the children [first, first + count), internal cells have a count of 0 with the first child cell immediately following and first referencing the second child cell.
+        struct Cell
+        {
+            dsphere bound;
+            uint32_t first = 0;
+            uint32_t count = 0;
+        };
+
+        using Cells = std::vector<Cell>;
+
+        /// build the hierarchy from the bounds of the current children, recursively splitting along the longest axis until cells have no more than maximumChildrenPerCell children.
+        void build(std::size_t maximumChildrenPerCell = 8);
+
+        /// traverse the children of the cells whose bounds pass intersects(const dsphere&), followed by the children that are outside the hierarchy.
+        /// All the children are traversed when there are no cells, i.e. before build() is called or after the cells have been cleared.
+        template<class V, class Intersects>
+        void traverseIntersecting(V& visitor, Intersects intersects) const
+        {
+            if (_cells.empty())
+            {
+                for (auto& child : _children) child->accept(visitor);
+                return;
+            }
+
+            _traverseIntersecting(0, visitor, intersects);
+            for (std::size_t i = _numBoundedChildren; i < _children.size(); ++i) _children[i]->accept(visitor);
+        }
+
+        void read(Input& input) override;
+        void write(Output& output) const override;
+
+        /// bound of the root cell, invalid if the hierarchy hasn't been built.
+        dsphere getBound() const { return _cells.empty() ? dsphere() : _cells.front().bound; }
+
+        Cells& getCells() { return _cells; }
+        const Cells& getCells() const { return _cells; }
+
+        uint32_t getNumBoundedChildren() const { return _numBoundedChildren; }
+
+    protected:
+        virtual ~BVHGroup();
+
+        template<class V, class Intersects>
+        void _traverseIntersecting(uint32_t index, V& visitor, Intersects& intersects) const
+        {
+            const Cell& cell = _cells[index];
+            if (!intersects(cell.bound)) return;
+
+            if (cell.count == 0)
+            {
+                _traverseIntersecting(index + 1, visitor, intersects);
+                _traverseIntersecting(cell.first, visitor, intersects);
+            }
+            else
+            {
+                for (uint32_t i = cell.first; i < cell.first + cell.count; ++i) _children[i]->accept(visitor);
+            }
+        }
+
+        Cells _cells;
+        uint32_t _numBoundedChildren = 0;
+    };
+    VSG_type_name(vsg::BVHGroup);
+
+} // namespace vsg
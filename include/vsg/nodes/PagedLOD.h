@@ -20,6 +20,7 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <vsg/vk/Semaphore.h>
 
 #include <array>
+#include <chrono>
 
 namespace vsg
 {
@@ -86,6 +87,9 @@ namespace vsg
 
         bool highResActive(uint64_t frameCount) const { return (frameCount - frameHighResLastUsed.load()) <= 1; }
 
+        /// return true if the high res child has been used or predictively prefetched in the current or previous frame, so a pending request for it should be kept.
+        bool highResRequired(uint64_t frameCount) const { return highResActive(frameCount) || (frameCount - framePrefetchLastRequested.load()) <= 1; }
+
     protected:
         virtual ~PagedLOD();
 
@@ -96,6 +100,7 @@ namespace vsg
         ref_ptr<const Options> options;
 
         mutable std::atomic_uint64_t frameHighResLastUsed{0};
+        mutable std::atomic_uint64_t framePrefetchLastRequested{0};
         mutable std::atomic_uint requestCount{0};
 
         enum RequestStatus : unsigned int
@@ -113,9 +118,20 @@ namespace vsg
 
         mutable std::atomic<RequestStatus> requestStatus{NoRequest};
         mutable uint32_t index = 0;
+        mutable uint32_t queueIndex = 0; // position in the DatabaseQueue heap, only valid while queued
 
         ref_ptr<Node> pending;
         ref_ptr<Semaphore> semaphore;
+
+        // bytes of host memory held by the high res subgraph's Data and device memory reserved when compiling it, assigned by the DatabasePager compile thread.
+        VkDeviceSize hostMemorySize = 0;
+        VkDeviceSize deviceMemorySize = 0;
+
+        // times each paging stage of the current request completed, assigned by the DatabasePager to collect DatabasePagerStats latencies.
+        using time_point = std::chrono::steady_clock::time_point;
+        time_point requestTime;
+        time_point readTime;
+        time_point compileTime;
     };
     VSG_type_name(vsg::PagedLOD);
 
@@ -39,6 +39,7 @@ namespace vsg
         // compile the Vulkan object, context parameter used for Device
         virtual void compile(Context& /*context*/) {}
 
+        /// assign the descriptor to wds, image/buffer info arrays are allocated from ScratchMemory::threadLocalInScope() so the caller must hold a ScratchMemoryScope until vkUpdateDescriptorSets has been called.
         virtual void assignTo(Context& context, VkWriteDescriptorSet& wds) const;
 
         virtual uint32_t getNumDescriptors() const { return 1; }
@@ -49,6 +49,7 @@ namespace vsg
         void read(Input& input) override;
         void write(Output& output) const override;
 
+        /// assign the stage settings to stageInfo, any specialization info is allocated from ScratchMemory::threadLocalInScope() so the caller must hold a ScratchMemoryScope until the pipeline is created.
         void apply(Context& context, VkPipelineShaderStageCreateInfo& stageInfo) const;
 
         // compile the Vulkan object, context parameter used for Device
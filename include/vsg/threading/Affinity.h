@@ -16,6 +16,7 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 
 #include <set>
 #include <thread>
+#include <vector>
 
 namespace vsg
 {
@@ -31,14 +32,23 @@ namespace vsg
 
         std::set<uint32_t> cpus;
 
-        operator bool() const { return !cpus.empty(); }
+        /// NUMA node that memory allocated by the thread should preferably come from, -1 to use the system default. Only supported under Linux.
+        int32_t memoryNode = -1;
+
+        /// return true if there is a CPU affinity or memoryNode to apply.
+        operator bool() const { return !cpus.empty() || memoryNode >= 0; }
     };
 
-    /// Set the CPU affinity of specifiied std::thread
+    /// Return an Affinity for each NUMA node, containing the node's CPUs with memoryNode set to the node.
+    /// Under Linux the topology is read from /sys/devices/system/node, on other platforms, or if the topology isn't available, a single Affinity containing all CPUs is returned.
+    extern VSG_DECLSPEC std::vector<Affinity> getNumaNodes();
+
+    /// Set the CPU affinity of specifiied std::thread, an empty Affinity::cpus sets the affinity to all CPUs.
+    /// Affinity::memoryNode is applied if thread is the current thread, under Linux the memory policy of another thread can't be set so a warning is reported.
     extern VSG_DECLSPEC void setAffinity(std::thread& thread, const Affinity& affinity);
 
-    /// Set the CPU affinity of current thread
-    /// Note, under Linux the CPU affinity of thread is inherited by any threads that it creates
+    /// Set the CPU affinity of current thread, an empty Affinity::cpus sets the affinity to all CPUs, and if Affinity::memoryNode is set the preferred NUMA node of the memory it allocates
+    /// Note, under Linux the CPU affinity and memory policy of thread is inherited by any threads that it creates
     extern VSG_DECLSPEC void setAffinity(const Affinity& affinity);
 
 } // namespace vsg
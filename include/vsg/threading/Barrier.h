@@ -13,19 +13,22 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 </editor-fold> */
 
 #include <vsg/core/Inherit.h>
+#include <vsg/threading/atomics.h>
 
 #include <condition_variable>
+#include <mutex>
 
 namespace vsg
 {
 
+    /// Reusable barrier that blocks threads till the specified number of threads have arrived.
+    /// Waiting threads first spin for up to spinCount iterations, to avoid the wake up latency of a condition variable when the barrier is released shortly after arrival, then park on the condition variable.
     class Barrier : public Inherit<Object, Barrier>
     {
     public:
-        Barrier(uint32_t num_thread) :
+        Barrier(uint32_t num_thread, uint32_t spinCount = 0) :
             _num_threads(num_thread),
-            _num_arrived(0),
-            _phase(0) {}
+            _spinCount(spinCount) {}
 
         Barrier(const Barrier&) = delete;
         Barrier& operator=(const Barrier&) = delete;
@@ -33,41 +36,56 @@ namespace vsg
         /// increment the arrived count and release the barrier if count matches number of threads to arrive otherwise waiting for the arrived count to match the number if threads to arrive
         void arrive_and_wait()
         {
-            std::unique_lock lock(_mutex);
+            auto my_phase = _phase.load();
             if (++_num_arrived == _num_threads)
             {
                 _release();
+                return;
             }
-            else
+
+            if (spin_wait(_spinCount, [&]() { return _phase.load() != my_phase; })) return;
+
+            ++_num_parked;
             {
-                auto my_phase = _phase;
-                _cv.wait(lock, [this, my_phase]() { return this->_phase != my_phase; });
+                std::unique_lock lock(_mutex);
+                _cv.wait(lock, [&]() { return _phase.load() != my_phase; });
             }
+            --_num_parked;
         }
 
         /// increment the arrived count and release the barrier if count matches number of threads to arrive, return immediately without waiting for release condition
         void arrive_and_drop()
         {
-            std::unique_lock lock(_mutex);
             if (++_num_arrived == _num_threads)
             {
                 _release();
             }
         }
 
+        uint32_t spinCount() const { return _spinCount; }
+
     protected:
         virtual ~Barrier() {}
 
         void _release()
         {
+            // reset the count before advancing the phase as threads released by the phase change may immediately arrive at the barrier again
             _num_arrived = 0;
             ++_phase;
-            _cv.notify_all();
+
+            // only threads that have given up spinning need waking
+            if (_num_parked.load() > 0)
+            {
+                std::scoped_lock lock(_mutex);
+                _cv.notify_all();
+            }
         }
 
         const uint32_t _num_threads;
-        uint32_t _num_arrived;
-        uint32_t _phase;
+        const uint32_t _spinCount;
+        std::atomic_uint32_t _num_arrived{0};
+        std::atomic_uint32_t _phase{0};
+        std::atomic_uint32_t _num_parked{0};
 
         std::mutex _mutex;
         std::condition_variable _cv;
@@ -13,28 +13,42 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 </editor-fold> */
 
 #include <vsg/threading/ActivityStatus.h>
+#include <vsg/threading/atomics.h>
 #include <vsg/ui/ApplicationEvent.h>
 
+#include <thread>
+
 namespace vsg
 {
 
+    /// Block threads till a new FrameStamp is set.
+    /// Waiting threads first spin for up to spinCount iterations before parking on the condition variable.
     class FrameBlock : public Inherit<Object, FrameBlock>
     {
     public:
         inline static const ref_ptr<FrameStamp> initial_value = {};
 
-        FrameBlock(ref_ptr<ActivityStatus> status) :
+        FrameBlock(ref_ptr<ActivityStatus> status, uint32_t spinCount = 0) :
             _value(initial_value),
-            _status(status) {}
+            _status(status),
+            _spinCount(spinCount) {}
 
         FrameBlock(const FrameBlock&) = delete;
         FrameBlock& operator=(const FrameBlock&) = delete;
 
         void set(ref_ptr<FrameStamp> frameStamp)
         {
-            std::scoped_lock lock(_mutex);
-            _value = frameStamp;
-            _cv.notify_all();
+            ref_ptr<FrameStamp> previous;
+            {
+                std::scoped_lock lock(_mutex);
+                previous = _value;
+                _value = frameStamp;
+                _currentFrameStamp = frameStamp.get();
+                _cv.notify_all();
+            }
+
+            // threads returning from wait_for_change() without the mutex may have loaded the previous FrameStamp and not yet taken a reference to it
+            while (_numSpinReaders.load() != 0) std::this_thread::yield();
         }
 
         ref_ptr<FrameStamp> get()
@@ -45,6 +59,8 @@ namespace vsg
 
         bool active() const { return _status->active(); }
 
+        uint32_t spinCount() const { return _spinCount; }
+
         void wake()
         {
             std::scoped_lock lock(_mutex);
@@ -53,6 +69,14 @@ namespace vsg
 
         bool wait_for_change(ref_ptr<FrameStamp>& value)
         {
+            if (spin_wait(_spinCount, [&]() { return _currentFrameStamp.load() != value.get() || !_status->active(); }))
+            {
+                ++_numSpinReaders;
+                value = _currentFrameStamp.load();
+                --_numSpinReaders;
+                return _status->active();
+            }
+
             std::unique_lock lock(_mutex);
             while (_value == value && _status->active())
             {
@@ -70,6 +94,13 @@ namespace vsg
         std::condition_variable _cv;
         ref_ptr<FrameStamp> _value;
         ref_ptr<ActivityStatus> _status;
+        const uint32_t _spinCount;
+
+        // copy of _value's pointer that waiting threads can spin on without taking the mutex
+        std::atomic<FrameStamp*> _currentFrameStamp{nullptr};
+
+        // number of threads taking a reference to _currentFrameStamp, set() waits for them before releasing the FrameStamp it replaced
+        std::atomic_uint32_t _numSpinReaders{0};
     };
     VSG_type_name(vsg::FrameBlock);
 
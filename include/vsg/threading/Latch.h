@@ -13,6 +13,7 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 </editor-fold> */
 
 #include <vsg/core/Inherit.h>
+#include <vsg/threading/atomics.h>
 
 #include <condition_variable>
 #include <mutex>
@@ -20,11 +21,14 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 namespace vsg
 {
 
+    /// Count down latch, threads calling wait() block till the count reaches zero.
+    /// Waiting threads first spin for up to spinCount iterations before parking on the condition variable.
     class Latch : public Inherit<Object, Latch>
     {
     public:
-        Latch(int num) :
-            _count(num) {}
+        Latch(int num, uint32_t spinCount = 0) :
+            _count(num),
+            _spinCount(spinCount) {}
 
         void set(int num)
         {
@@ -64,6 +68,8 @@ namespace vsg
 
         void wait()
         {
+            if (spin_wait(_spinCount, [&]() { return _count <= 0; })) return;
+
             std::unique_lock lock(_mutex);
             while (_count > 0)
             {
@@ -79,10 +85,13 @@ namespace vsg
 
         int count() const { return _count.load(); }
 
+        uint32_t spinCount() const { return _spinCount; }
+
     protected:
         virtual ~Latch() {}
 
         std::atomic_int _count;
+        const uint32_t _spinCount;
         std::mutex _mutex;
         std::condition_variable _cv;
     };
@@ -14,6 +14,7 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 
 #include <vsg/threading/ActivityStatus.h>
 #include <vsg/threading/Latch.h>
+#include <vsg/threading/RingQueue.h>
 
 #include <list>
 
@@ -25,46 +26,63 @@ namespace vsg
         virtual void run() = 0;
     };
 
+    /// Thread safe FIFO queue of Operation.
+    /// Operations are held in a lock free RingQueue so add() and take() don't allocate or lock, once the ring is full further operations spill into a mutex protected overflow list that is drained once the ring is empty, preserving FIFO order.
+    /// Threads blocked in take_when_avilable() are parked on a condition variable and only woken by add() or release(), rather than polling.
     class VSG_DECLSPEC OperationQueue : public Inherit<Object, OperationQueue>
     {
     public:
-        OperationQueue(ref_ptr<ActivityStatus> status);
+        OperationQueue(ref_ptr<ActivityStatus> status, size_t capacity = 1024);
 
         ActivityStatus* getStatus() { return _status; }
         const ActivityStatus* getStatus() const { return _status; }
 
         void add(ref_ptr<Operation> operation)
         {
-            std::scoped_lock lock(_mutex);
-            _queue.emplace_back(operation);
-            _cv.notify_one();
+            _push(operation);
+            _notify(1);
         }
 
         template<typename Iterator>
         void add(Iterator begin, Iterator end)
         {
             size_t numAdditions = 0;
-            std::scoped_lock lock(_mutex);
             for (auto itr = begin; itr != end; ++itr)
             {
-                _queue.emplace_back(*itr);
+                _push(*itr);
                 ++numAdditions;
             }
 
-            if (numAdditions == 1)
-                _cv.notify_one();
-            else if (numAdditions > 1)
-                _cv.notify_all();
+            _notify(numAdditions);
         }
 
+        /// remove and return the operation at the front of the queue without waiting, return null if the queue is empty.
         ref_ptr<Operation> take();
 
+        /// remove and return the operation at the front of the queue, parking the calling thread till one is available, return null if the status has been cancelled.
         ref_ptr<Operation> take_when_avilable();
 
+        /// wake all threads waiting in take_when_avilable() so they can check the ActivityStatus, call after cancelling the status.
+        void release();
+
+        /// approximate test of whether the queue is empty, only exact when no other threads are adding or taking operations.
+        bool empty() const { return _ring.size() == 0 && _overflowSize.load() == 0; }
+
     protected:
+        void _push(ref_ptr<Operation> operation);
+
+        /// wake threads waiting for operations after numAdditions operations have been added, subclasses can override it to also wake threads waiting elsewhere.
+        virtual void _notify(size_t numAdditions);
+
+        RingQueue<ref_ptr<Operation>> _ring;
+
         std::mutex _mutex;
         std::condition_variable _cv;
-        std::list<ref_ptr<Operation>> _queue;
+        std::list<ref_ptr<Operation>> _overflow;
+        std::atomic_size_t _overflowSize{0};
+        std::atomic_uint64_t _epoch{0};
+        std::atomic_uint32_t _numWaiting{0};
+
         ref_ptr<ActivityStatus> _status;
     };
     VSG_type_name(vsg::OperationQueue)
@@ -12,13 +12,18 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 
 </editor-fold> */
 
+#include <vsg/threading/Latch.h>
 #include <vsg/threading/OperationQueue.h>
+#include <vsg/threading/WorkStealingQueue.h>
 
 #include <thread>
 
 namespace vsg
 {
 
+    /// Pool of threads that run Operations, using a work stealing scheduler.
+    /// Each thread has its own WorkStealingQueue, operations added from within a running operation are pushed onto the running thread's queue and idle threads steal from the other threads' queues.
+    /// Operations added from threads outside the pool are placed in the shared queue, adding to it directly also wakes the pool's parked threads.
     class VSG_DECLSPEC OperationThreads : public Inherit<Object, OperationThreads>
     {
     public:
@@ -27,21 +32,26 @@ namespace vsg
         OperationThreads(const OperationThreads&) = delete;
         OperationThreads& operator=(const OperationThreads& rhs) = delete;
 
-        void add(ref_ptr<Operation> operation)
-        {
-            queue->add(operation);
-        }
+        /// add operation, when called from an operation running on one of this OperationThreads' threads it's added to that thread's work stealing queue, otherwise it's added to the shared queue.
+        void add(ref_ptr<Operation> operation);
 
         template<typename Iterator>
         void add(Iterator begin, Iterator end)
         {
-            queue->add(begin, end);
+            for (auto itr = begin; itr != end; ++itr)
+            {
+                add(*itr);
+            }
         }
 
         /// use this thread to run operations till the queue is empty as well
         /// this thread will consume and run operations in parallel with any threads associated with this OperationThreads.
         void run();
 
+        /// use this thread to run operations till the latch is released, so that an operation waiting on the child operations it has added helps run them rather than blocking.
+        /// Once no operations are left to take the thread spins briefly in case the operations still running add more, then parks on the latch.
+        void run(Latch& latch);
+
         /// stop threads
         void stop();
 
@@ -55,6 +65,26 @@ namespace vsg
         {
             stop();
         }
+
+        /// take the next operation, first from the thread's own queue, then the shared queue, then stealing from the other threads' queues.
+        ref_ptr<Operation> _next(uint32_t index);
+
+        /// index of the calling thread's work stealing queue, or the number of queues if the calling thread isn't one of this OperationThreads' threads.
+        uint32_t _threadIndex() const;
+
+        void _runThread(uint32_t index);
+        void _notify();
+
+        /// the shared queue, waking the pool's parked threads when operations are added to it
+        class SharedQueue;
+
+        std::vector<ref_ptr<WorkStealingQueue>> _workQueues;
+
+        // idle threads park on the condition variable until _epoch is incremented by the addition of an operation
+        std::atomic_uint64_t _epoch{0};
+        std::atomic_uint32_t _numParked{0};
+        std::mutex _parkMutex;
+        std::condition_variable _parkCV;
     };
     VSG_type_name(vsg::OperationThreads)
 
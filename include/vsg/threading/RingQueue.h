@@ -0,0 +1,130 @@
+#pragma once
+
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2020 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace vsg
+{
+
+    /// Bounded lock free multi-producer/multi-consumer FIFO queue, using a ring of cells each with a sequence number that tells producers and consumers whether the cell is ready for them.
+    /// Based on Dmitry Vyukov's bounded MPMC queue. push() returns false when the queue is full and pop() returns false when it's empty, neither blocks.
+    template<typename T>
+    class RingQueue
+    {
+    public:
+        explicit RingQueue(std::size_t requestedCapacity = 1024)
+        {
+            // capacity must be a power of two so that positions can be wrapped with a mask
+            std::size_t capacity = 2;
+            while (capacity < requestedCapacity) capacity *= 2;
+
+            _cells.reset(new Cell[capacity]);
+            _mask = capacity - 1;
+
+            for (std::size_t i = 0; i < capacity; ++i)
+            {
+                _cells[i].sequence.store(i, std::memory_order_relaxed);
+            }
+        }
+
+        RingQueue(const RingQueue&) = delete;
+        RingQueue& operator=(const RingQueue&) = delete;
+
+        std::size_t capacity() const { return _mask + 1; }
+
+        /// add value to the back of the queue, return false if the queue is full.
+        bool push(const T& value)
+        {
+            Cell* cell = nullptr;
+            std::size_t pos = _enqueuePos.load(std::memory_order_relaxed);
+            for (;;)
+            {
+                cell = &_cells[pos & _mask];
+                std::size_t sequence = cell->sequence.load(std::memory_order_acquire);
+                auto diff = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(pos);
+                if (diff == 0)
+                {
+                    if (_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+                }
+                else if (diff < 0)
+                {
+                    return false;
+                }
+                else
+                {
+                    pos = _enqueuePos.load(std::memory_order_relaxed);
+                }
+            }
+
+            cell->value = value;
+            cell->sequence.store(pos + 1, std::memory_order_release);
+            return true;
+        }
+
+        /// remove value from the front of the queue, return false if the queue is empty.
+        bool pop(T& value)
+        {
+            Cell* cell = nullptr;
+            std::size_t pos = _dequeuePos.load(std::memory_order_relaxed);
+            for (;;)
+            {
+                cell = &_cells[pos & _mask];
+                std::size_t sequence = cell->sequence.load(std::memory_order_acquire);
+                auto diff = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(pos + 1);
+                if (diff == 0)
+                {
+                    if (_dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+                }
+                else if (diff < 0)
+                {
+                    return false;
+                }
+                else
+                {
+                    pos = _dequeuePos.load(std::memory_order_relaxed);
+                }
+            }
+
+            value = cell->value;
+            cell->value = T(); // release the queue's copy so references aren't held by empty cells
+            cell->sequence.store(pos + _mask + 1, std::memory_order_release);
+            return true;
+        }
+
+        /// approximate number of values in the queue, only exact when no other threads are pushing or popping.
+        std::size_t size() const
+        {
+            std::size_t enqueuePos = _enqueuePos.load(std::memory_order_relaxed);
+            std::size_t dequeuePos = _dequeuePos.load(std::memory_order_relaxed);
+            return enqueuePos > dequeuePos ? (enqueuePos - dequeuePos) : 0;
+        }
+
+    protected:
+        struct Cell
+        {
+            std::atomic<std::size_t> sequence;
+            T value;
+        };
+
+        // keep the producer and consumer positions on separate cache lines to avoid false sharing between them
+        std::unique_ptr<Cell[]> _cells;
+        std::size_t _mask = 0;
+        alignas(64) std::atomic<std::size_t> _enqueuePos{0};
+        alignas(64) std::atomic<std::size_t> _dequeuePos{0};
+    };
+
+} // namespace vsg
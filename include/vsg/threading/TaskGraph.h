@@ -0,0 +1,70 @@
+#pragma once
+
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2020 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/threading/OperationThreads.h>
+
+#include <functional>
+
+namespace vsg
+{
+
+    /// Graph of tasks with dependencies between them, run on an OperationThreads pool.
+    /// Each Task has a join counter that is reset to its number of dependencies when the graph is run, as each task completes it decrements its successors' join counters and adds any that reach zero to the OperationThreads.
+    class VSG_DECLSPEC TaskGraph : public Inherit<Object, TaskGraph>
+    {
+    public:
+        TaskGraph();
+
+        using Function = std::function<void()>;
+
+        struct Task : public Operation
+        {
+            Function function;
+            std::vector<Task*> successors;
+            uint32_t numDependencies = 0;
+            std::atomic_uint32_t joinCount{0};
+            TaskGraph* graph = nullptr;
+
+            void run() override;
+        };
+
+        using Tasks = std::vector<ref_ptr<Task>>;
+
+        /// add a task to the graph, the returned Task is owned by the TaskGraph.
+        Task* add(Function function);
+
+        /// make the after Task wait for the before Task to complete before it's run.
+        void precede(Task* before, Task* after);
+
+        /// run all the tasks, respecting their dependencies, on the OperationThreads with the calling thread helping, returning once all the tasks have completed.
+        /// If operationThreads is null or has no threads the tasks are run on the calling thread. Returns false without running any tasks if the dependencies contain a cycle.
+        /// A TaskGraph may be run multiple times, but not concurrently.
+        bool run(OperationThreads* operationThreads);
+
+        void clear() { _tasks.clear(); }
+
+        const Tasks& getTasks() const { return _tasks; }
+
+    protected:
+        virtual ~TaskGraph();
+
+        void _completed(Task* task);
+
+        Tasks _tasks;
+        OperationThreads* _operationThreads = nullptr;
+        ref_ptr<Latch> _latch;
+    };
+    VSG_type_name(vsg::TaskGraph);
+
+} // namespace vsg
@@ -0,0 +1,74 @@
+#pragma once
+
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2020 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/threading/OperationQueue.h>
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+namespace vsg
+{
+
+    /// Chase-Lev work stealing deque of Operation.
+    /// The owning thread pushes and takes operations from the bottom of the deque, while other threads steal from the top without locking.
+    class VSG_DECLSPEC WorkStealingQueue : public Inherit<Object, WorkStealingQueue>
+    {
+    public:
+        explicit WorkStealingQueue(uint32_t initialCapacity = 256);
+
+        WorkStealingQueue(const WorkStealingQueue&) = delete;
+        WorkStealingQueue& operator=(const WorkStealingQueue& rhs) = delete;
+
+        /// add operation to the bottom of the deque, must only be called from the owning thread.
+        void push(ref_ptr<Operation> operation);
+
+        /// remove and return the most recently pushed operation, must only be called from the owning thread.
+        ref_ptr<Operation> take();
+
+        /// remove and return the oldest operation, may be called from any thread. Returns null if the deque is empty or another thread took the operation first.
+        ref_ptr<Operation> steal();
+
+        bool empty() const { return _bottom.load(std::memory_order_relaxed) <= _top.load(std::memory_order_relaxed); }
+
+    protected:
+        virtual ~WorkStealingQueue();
+
+        struct Array
+        {
+            explicit Array(int64_t in_capacity) :
+                capacity(in_capacity),
+                mask(in_capacity - 1),
+                buffer(new std::atomic<Operation*>[static_cast<std::size_t>(in_capacity)]) {}
+
+            Operation* get(int64_t i) const { return buffer[i & mask].load(std::memory_order_relaxed); }
+            void put(int64_t i, Operation* operation) { buffer[i & mask].store(operation, std::memory_order_relaxed); }
+
+            const int64_t capacity;
+            const int64_t mask;
+            std::unique_ptr<std::atomic<Operation*>[]> buffer;
+        };
+
+        Array* _grow(Array* array, int64_t bottom, int64_t top);
+
+        std::atomic<int64_t> _top{0};
+        std::atomic<int64_t> _bottom{0};
+        std::atomic<Array*> _array;
+
+        // arrays are only released on destruction, as thieves may still be reading from an array that has been replaced by _grow().
+        std::vector<std::unique_ptr<Array>> _arrays;
+    };
+    VSG_type_name(vsg::WorkStealingQueue)
+
+} // namespace vsg
@@ -13,22 +13,61 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 </editor-fold> */
 
 #include <atomic>
+#include <cstdint>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#    include <intrin.h>
+#endif
 
 namespace vsg
 {
 
+    /// hint to the CPU that the calling thread is spin waiting, reducing the contention with a hyper-threaded sibling and the cost of leaving the spin loop.
+    inline void cpu_relax()
+    {
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+        _mm_pause();
+#elif defined(__x86_64__) || defined(__i386__)
+        __builtin_ia32_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+        __asm__ __volatile__("yield");
+#endif
+    }
+
+    /// spin for up to spinCount iterations waiting for condition() to return true, return true if it did, or false if the caller should fall back to blocking.
+    template<typename F>
+    bool spin_wait(uint32_t spinCount, F condition)
+    {
+        for (uint32_t i = 0; i < spinCount; ++i)
+        {
+            if (condition()) return true;
+            cpu_relax();
+        }
+        return false;
+    }
+
+    /// set reference to t if t is lower than the current value, return true if the value was changed.
     template<typename T>
-    void exchange_if_lower(std::atomic<T>& reference, T t)
+    bool exchange_if_lower(std::atomic<T>& reference, T t)
     {
         T original_value = reference.load();
-        while (t < original_value && !reference.compare_exchange_weak(original_value, t)) {}
+        while (t < original_value)
+        {
+            if (reference.compare_exchange_weak(original_value, t)) return true;
+        }
+        return false;
     };
 
+    /// set reference to t if t is greater than the current value, return true if the value was changed.
     template<typename T>
-    void exchange_if_greater(std::atomic<T>& reference, T t)
+    bool exchange_if_greater(std::atomic<T>& reference, T t)
     {
         T original_value = reference.load();
-        while (t > original_value && !reference.compare_exchange_weak(original_value, t)) {}
+        while (t > original_value)
+        {
+            if (reference.compare_exchange_weak(original_value, t)) return true;
+        }
+        return false;
     };
 
     template<typename T>
@@ -0,0 +1,87 @@
+#pragma once
+
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2020 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/threading/OperationThreads.h>
+
+#include <algorithm>
+
+namespace vsg
+{
+
+    /// Operation used by parallel_for to run a range of chunks, recursively splitting off the upper half of its chunks as new operations so idle threads can steal them.
+    template<typename Function>
+    struct ParallelForOperation : public Operation
+    {
+        ParallelForOperation(OperationThreads* in_operationThreads, Latch* in_latch, Function* in_function, size_t in_begin, size_t in_end, size_t in_grainSize, size_t in_firstChunk, size_t in_lastChunk) :
+            operationThreads(in_operationThreads),
+            latch(in_latch),
+            function(in_function),
+            begin(in_begin),
+            end(in_end),
+            grainSize(in_grainSize),
+            firstChunk(in_firstChunk),
+            lastChunk(in_lastChunk) {}
+
+        void run() override
+        {
+            while ((lastChunk - firstChunk) > 1)
+            {
+                size_t midChunk = (firstChunk + lastChunk) / 2;
+                operationThreads->add(ref_ptr<Operation>(new ParallelForOperation(operationThreads, latch, function, begin, end, grainSize, midChunk, lastChunk)));
+                lastChunk = midChunk;
+            }
+
+            size_t chunkBegin = begin + firstChunk * grainSize;
+            size_t chunkEnd = std::min(end, chunkBegin + grainSize);
+            (*function)(chunkBegin, chunkEnd);
+
+            latch->count_down();
+        }
+
+        OperationThreads* operationThreads;
+        ref_ptr<Latch> latch;
+        Function* function;
+        size_t begin;
+        size_t end;
+        size_t grainSize;
+        size_t firstChunk;
+        size_t lastChunk;
+    };
+
+    /// Call function(chunkBegin, chunkEnd) for each chunk of up to grainSize elements of the range [begin, end), running the chunks in parallel on the OperationThreads.
+    /// The calling thread helps run the chunks and parallel_for returns once all of them have completed, so function may safely reference the caller's local variables.
+    /// If operationThreads is null, has no threads or the range fits in a single chunk the function is called once on the calling thread for the whole range.
+    template<typename Function>
+    void parallel_for(OperationThreads* operationThreads, size_t begin, size_t end, size_t grainSize, Function function)
+    {
+        if (end <= begin) return;
+        if (grainSize == 0) grainSize = 1;
+
+        size_t numChunks = (end - begin + grainSize - 1) / grainSize;
+        if (!operationThreads || operationThreads->threads.empty() || numChunks == 1)
+        {
+            function(begin, end);
+            return;
+        }
+
+        auto latch = Latch::create(static_cast<int>(numChunks));
+
+        // run the first chunk on the calling thread, splitting the rest off for the OperationThreads
+        ref_ptr<Operation> root(new ParallelForOperation<Function>(operationThreads, latch.get(), &function, begin, end, grainSize, 0, numChunks));
+        root->run();
+
+        operationThreads->run(*latch);
+    }
+
+} // namespace vsg
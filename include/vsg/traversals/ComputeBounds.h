@@ -13,6 +13,7 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 </editor-fold> */
 
 #include <vsg/maths/box.h>
+#include <vsg/threading/OperationThreads.h>
 #include <vsg/traversals/ArrayState.h>
 
 namespace vsg
@@ -31,7 +32,12 @@ namespace vsg
         using MatrixStack = std::vector<mat4>;
         MatrixStack matrixStack;
 
+        /// optional OperationThreads used to compute the bounds of the children of Groups with more than parallelGrainSize children in parallel.
+        ref_ptr<OperationThreads> operationThreads;
+        size_t parallelGrainSize = 64;
+
         void apply(const Node& node) override;
+        void apply(const Group& group) override;
         void apply(const StateGroup& stategroup) override;
         void apply(const MatrixTransform& transform) override;
         void apply(const Geometry& geometry) override;
@@ -0,0 +1,157 @@
+#pragma once
+
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2020 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/core/Inherit.h>
+#include <vsg/maths/mat4.h>
+#include <vsg/maths/plane.h>
+
+#include <vector>
+
+namespace vsg
+{
+
+    // forward declare
+    class Node;
+    class FrameStamp;
+
+    /** CullCache records the CullGroup, CullNode and LOD results of a RecordTraversal for each view, so that the following frame can take advantage of the temporal coherence of the camera.
+     *  When the view has moved less than the eyeMovementThreshold and rotationThreshold from where the results were last evaluated the previous results are reused without any testing,
+     *  otherwise nodes that were culled are first tested against the plane that rejected them on the previous frame (plane-coherency). Results are only recorded while the view moves less than the thresholds
+     *  between frames, so a fast moving view doesn't pay for recording results it won't reuse.
+     *  Results are matched to nodes by the order of the traversal, so instanced subgraphs are cached per instance. Reused results assume the subgraphs are static, changes to transforms or bounds within the scene graph
+     *  are only picked up once the view has moved beyond the thresholds, so the thresholds default to 0.0 which only reuses results when the view hasn't changed.
+     *  Nodes are matched by address, so the results of a view are discarded whenever the RecordTraversal's DatabasePager merges or expires a subgraph, as a node allocated at the address of an expired node would otherwise match its stale result.
+     *  Views are identified by the order they are recorded within each frame, assign to RecordTraversal via setCullCache() to enable. A CullCache holds the state of the traversal in progress so must not be shared between RecordTraversals that record on different threads,
+     *  assign each RecordTraversal its own CullCache.*/
+    class VSG_DECLSPEC CullCache : public Inherit<Object, CullCache>
+    {
+    public:
+        CullCache();
+
+        /// distance, in world coordinates, that the eye may move from where the cached results were last evaluated before they are re-evaluated.
+        double eyeMovementThreshold = 0.0;
+
+        /// change in the view direction, in radians, from where the cached results were last evaluated before they are re-evaluated.
+        double rotationThreshold = 0.0;
+
+        struct Entry
+        {
+            const Node* node = nullptr;
+            uint32_t end = 0;    // index of the first entry after the entries recorded for the node's subgraph
+            uint16_t result = 0; // 0 when culled, otherwise CullGroup/CullNode 1, LOD 1 + index of the child traversed
+            uint16_t plane = 0;  // plane that last rejected the node's bound
+        };
+
+        using Entries = std::vector<Entry>;
+
+        struct View
+        {
+            dmat4 projectionMatrix;
+            dmat4 viewMatrix;                 // view that the cached results were last evaluated with
+            dmat4 previousProjectionMatrix;
+            dmat4 previousViewMatrix;         // view of the previous frame, used to decide whether the view has settled enough to record results
+            bool reuse = false;               // true when the previous results are reused for the current frame
+            uint64_t sceneGraphModifiedCount = 0; // DatabasePager::sceneGraphModifiedCount when the previous results were recorded
+            Entries previous;
+            Entries current;
+            std::size_t previousPosition = 0;
+        };
+
+        /// start a new view, called by RecordTraversal::setProjectionAndViewMatrix(). When no FrameStamp is assigned each call is treated as a new frame of the same view.
+        /// The previous results are discarded when sceneGraphModifiedCount differs from the value passed in when they were recorded.
+        void beginView(const FrameStamp* frameStamp, const dmat4& projMatrix, const dmat4& viewMatrix, uint64_t sceneGraphModifiedCount = 0);
+
+        /// return true if the two view matrices are the same or differ by less than the eyeMovementThreshold and rotationThreshold.
+        bool withinThresholds(const dmat4& lhs, const dmat4& rhs) const;
+
+        /// return true when the results of the previous frame are reused for the current view.
+        bool reuse() const { return _view && _view->reuse; }
+
+        /** test the node's bound against the polytope, then call select() to get the node's result and traverse(result) when the result is non zero.
+         *  When the node was recorded at the same position in the previous frame the previous result is reused, or the plane that previously rejected the node is tested first.*/
+        template<class Polytope, typename T, class Select, class Traverse>
+        void cull(const Node* node, const Polytope& polytope, const t_sphere<T>& bound, Select select, Traverse traverse)
+        {
+            if (!_view)
+            {
+                if (intersect(polytope, bound))
+                {
+                    if (auto result = select()) traverse(result);
+                }
+                return;
+            }
+
+            const Entry* previous = _matchPrevious(node);
+
+            uint16_t result = 0;
+            uint16_t planeIndex = previous ? previous->plane : 0;
+            if (previous && _view->reuse)
+            {
+                result = previous->result;
+            }
+            else if (intersect(polytope, bound, planeIndex))
+            {
+                result = select();
+            }
+
+            _record(node, previous, result, planeIndex, traverse);
+        }
+
+        /// record the result of a node that has been tested by the caller, such as by a batched intersection test, and call traverse(result) when the result is non zero.
+        template<class Traverse>
+        void record(const Node* node, uint16_t result, Traverse traverse)
+        {
+            if (!_view)
+            {
+                if (result) traverse(result);
+                return;
+            }
+
+            const Entry* previous = _matchPrevious(node);
+            _record(node, previous, result, previous ? previous->plane : 0, traverse);
+        }
+
+    protected:
+        virtual ~CullCache();
+
+        inline const Entry* _matchPrevious(const Node* node)
+        {
+            auto& view = *_view;
+            if (view.previousPosition < view.previous.size() && view.previous[view.previousPosition].node == node) return &view.previous[view.previousPosition++];
+            return nullptr;
+        }
+
+        template<class Traverse>
+        void _record(const Node* node, const Entry* previous, uint16_t result, uint16_t planeIndex, Traverse traverse)
+        {
+            auto& view = *_view;
+            auto index = view.current.size();
+            view.current.push_back(Entry{node, 0, result, planeIndex});
+
+            if (result) traverse(result);
+
+            view.current[index].end = static_cast<uint32_t>(view.current.size());
+
+            // skip over any entries from the previous frame's subgraph that weren't matched this frame
+            if (previous) view.previousPosition = previous->end;
+        }
+
+        std::vector<View> _views;
+        View* _view = nullptr;
+        uint64_t _frameCount = 0;
+        std::size_t _viewIndex = 0;
+    };
+    VSG_type_name(vsg::CullCache);
+
+} // namespace vsg
@@ -37,6 +37,7 @@ namespace vsg
         void apply(const LOD& lod) override;
         void apply(const PagedLOD& plod) override;
         void apply(const CullNode& cn) override;
+        void apply(const BVHGroup& bvhGroup) override;
 
         void apply(const VertexIndexDraw& vid) override;
         void apply(const Geometry& geometry) override;
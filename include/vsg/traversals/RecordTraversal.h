@@ -16,6 +16,9 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <vsg/core/type_name.h>
 #include <vsg/maths/mat4.h>
 
+#include <chrono>
+#include <deque>
+
 namespace vsg
 {
 
@@ -27,6 +30,7 @@ namespace vsg
     class PagedLOD;
     class StateGroup;
     class CullGroup;
+    class BVHGroup;
     class CullNode;
     class MatrixTransform;
     class Command;
@@ -36,6 +40,7 @@ namespace vsg
     class DatabasePager;
     class FrameStamp;
     class CulledPagedLODs;
+    class CullCache;
 
     class RecordTraversal;
     VSG_type_name(vsg::RecordTraversal);
@@ -57,6 +62,10 @@ namespace vsg
         void setDatabasePager(DatabasePager* dp);
         DatabasePager* getDatabasePager() { return _databasePager; }
 
+        /// assign a CullCache to reuse the CullGroup, CullNode and LOD results from previous frames, nullptr (the default) disables caching.
+        void setCullCache(CullCache* cullCache);
+        CullCache* getCullCache() { return _cullCache; }
+
         void setProjectionAndViewMatrix(const dmat4& projMatrix, const dmat4& viewMatrix);
 
         void apply(const Object& object);
@@ -67,6 +76,7 @@ namespace vsg
         void apply(const LOD& lod);
         void apply(const PagedLOD& pagedLOD);
         void apply(const CullGroup& cullGroup);
+        void apply(const BVHGroup& bvhGroup);
         void apply(const CullNode& cullNode);
 
         // Vulkan nodes
@@ -75,6 +85,15 @@ namespace vsg
         void apply(const Commands& commands);
         void apply(const Command& command);
 
+    protected:
+        /// traverse the children of a group, batch testing the bounds of CullNode and CullGroup children against the frustum when the group has several children.
+        /// Children whose exact type is CullNode or CullGroup bypass accept() and apply(const CullNode&)/apply(const CullGroup&), with visible children traversed directly, which visits the same nodes in the same order as apply() would.
+        /// The apply() methods aren't virtual so subclasses of RecordTraversal can't intercept these children via apply() either way, while subclasses of CullNode and CullGroup, and all other children, are still visited through accept().
+        void _traverse(const Group& group);
+
+        void _updatePrefetch(const dmat4& viewMatrix);
+        void _prefetch(const PagedLOD& plod);
+
     private:
         FrameStamp* _frameStamp = nullptr;
         State* _state = nullptr;
@@ -82,6 +101,20 @@ namespace vsg
         // used to handle loading of PagedLOD external children.
         DatabasePager* _databasePager = nullptr;
         CulledPagedLODs* _culledPagedLODs = nullptr;
+
+        // optional cache of cull results used to exploit the temporal coherence of the view
+        CullCache* _cullCache = nullptr;
+
+        // used for predictive prefetch of PagedLOD external children, the eye position is sampled on the first view of each frame.
+        struct EyeSample
+        {
+            uint64_t frameCount;
+            std::chrono::steady_clock::time_point time;
+            dvec3 eye;
+        };
+        std::deque<EyeSample> _eyeSamples;
+        bool _prefetchActive = false;
+        dvec3 _prefetchEyeOffset; // predicted camera displacement in eye coordinates
     };
 
 } // namespace vsg
@@ -0,0 +1,105 @@
+#pragma once
+
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2020 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/core/Visitor.h>
+#include <vsg/io/DatabasePager.h>
+#include <vsg/maths/mat4.h>
+#include <vsg/viewer/Camera.h>
+
+namespace vsg
+{
+
+    /// Sequence of projection and view matrices sampled each frame, used to record camera motion so that it can be replayed deterministically.
+    class VSG_DECLSPEC CameraPath : public Inherit<Object, CameraPath>
+    {
+    public:
+        CameraPath();
+
+        struct Sample
+        {
+            double time = 0.0; // seconds since the first sample
+            dmat4 projectionMatrix;
+            dmat4 viewMatrix;
+        };
+
+        using Samples = std::vector<Sample>;
+        Samples samples;
+
+        /// append the camera's current projection and view matrices.
+        void record(double time, const Camera& camera);
+
+        void read(Input& input) override;
+        void write(Output& output) const override;
+
+    protected:
+        virtual ~CameraPath();
+    };
+    VSG_type_name(vsg::CameraPath);
+
+    /// Event handler that records the camera's projection and view matrices into a CameraPath on each FrameEvent.
+    class VSG_DECLSPEC RecordCameraPath : public Inherit<Visitor, RecordCameraPath>
+    {
+    public:
+        RecordCameraPath(ref_ptr<Camera> in_camera, ref_ptr<CameraPath> in_path = {});
+
+        ref_ptr<Camera> camera;
+        ref_ptr<CameraPath> path;
+
+        void apply(FrameEvent& frame) override;
+
+    protected:
+        time_point _startTime;
+    };
+    VSG_type_name(vsg::RecordCameraPath);
+
+    /// Replay a CameraPath against a paged scene graph through RecordTraversal and DatabasePager without a window, collecting paging statistics.
+    /// The DatabasePager should not have a CompileTraversal assigned, so that subgraphs are read and merged without compiling, allowing replays on machines without a GPU.
+    class VSG_DECLSPEC CameraPathReplay : public Inherit<Object, CameraPathReplay>
+    {
+    public:
+        CameraPathReplay(ref_ptr<CameraPath> in_path, ref_ptr<Node> in_scenegraph, ref_ptr<DatabasePager> in_databasePager = {});
+
+        ref_ptr<CameraPath> path;
+        ref_ptr<Node> scenegraph;
+        ref_ptr<DatabasePager> databasePager;
+
+        /// maximum state slot used by the scene graph, see CommandGraph::maxSlot.
+        uint32_t maxSlot = 2;
+
+        /// pace frames to the recorded sample times, otherwise frames are replayed back to back.
+        bool realTime = true;
+
+        /// number of frames to keep replaying the last sample once the end of the path is reached, waiting for all high res subgraphs to be loaded.
+        uint32_t maxSettleFrames = 1000;
+
+        struct Results
+        {
+            uint32_t numFrames = 0;
+            uint32_t numFramesWithMissingHighRes = 0;
+            bool reachedFullResolution = false; // a frame at the path's last sample had no high res subgraphs missing within maxSettleFrames
+            double timeToFullResolution = -1.0; // seconds from the start of the first frame at the path's last sample until the end of the first of those frames with no high res subgraphs missing, -1.0 if not reached.
+            uint32_t peakNumHighResSubgraphs = 0;
+            VkDeviceSize peakHostMemory = 0;   // peak DatabasePager::hostMemoryInUse, the Data held by the merged high res subgraphs, so is valid for CPU only replays
+            VkDeviceSize peakDeviceMemory = 0; // peak DatabasePager::deviceMemoryInUse, always 0 for CPU only replays as nothing is compiled
+        };
+
+        /// run the replay, starting the DatabasePager if it hasn't already been started.
+        Results run();
+
+    protected:
+        virtual ~CameraPathReplay();
+    };
+    VSG_type_name(vsg::CameraPathReplay);
+
+} // namespace vsg
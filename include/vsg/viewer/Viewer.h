@@ -12,6 +12,7 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 
 </editor-fold> */
 
+#include <vsg/threading/Affinity.h>
 #include <vsg/threading/Barrier.h>
 #include <vsg/threading/FrameBlock.h>
 #include <vsg/traversals/CompileTraversal.h>
@@ -97,6 +98,13 @@ namespace vsg
 
         std::list<std::thread> threads;
 
+        /// CPU affinity of the record threads created by setupThreading(), one entry per RecordAndSubmitTask, applied to all the threads recording that task's CommandGraphs.
+        /// Use getNumaNodes() to keep each task's record threads, and the CommandPool memory they allocate, on a single NUMA node. Tasks without an entry, or with an empty Affinity, aren't pinned.
+        std::vector<Affinity> recordThreadAffinities;
+
+        /// number of iterations threads waiting on the FrameBlock and Barriers created by setupThreading() spin before parking, trading CPU time for lower frame handoff latency. 0 parks immediately.
+        uint32_t threadingSpinCount = 0;
+
         void setupThreading();
         void stopThreading();
 
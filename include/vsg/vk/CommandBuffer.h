@@ -44,6 +44,7 @@ namespace vsg
         void setCurrentPipelineLayout(VkPipelineLayout pipelineLayout) { _currentPipelineLayout = pipelineLayout; }
         VkPipelineLayout getCurrentPipelineLayout() const { return _currentPipelineLayout; }
 
+        /// deprecated, no longer used by the VSG as ScratchMemory::threadLocal() and ScratchMemoryScope are used instead, kept for backwards compatibility.
         ref_ptr<ScratchMemory> scratchMemory;
 
     protected:
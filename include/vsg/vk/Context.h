@@ -12,8 +12,13 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 
 </editor-fold> */
 
+#include <condition_variable>
 #include <deque>
 #include <memory>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <unordered_map>
 
 #include <vsg/core/Object.h>
 #include <vsg/core/ScratchMemory.h>
@@ -47,6 +52,43 @@ namespace vsg
         ref_ptr<Buffer> _scratchBuffer;
     };
 
+    /// Coordinates the compile of objects shared between subgraphs that several threads compile at the same time, such as the DatabasePager's compile threads.
+    /// Assigned to each thread's Context::concurrentCompile, compile(Context&) implementations take a ConcurrentCompile::Lock around their check-then-create so
+    /// that only one thread creates an object's Vulkan objects, and objects that record transfers are registered against the semaphore of the batch that submits them.
+    class VSG_DECLSPEC ConcurrentCompile : public Inherit<Object, ConcurrentCompile>
+    {
+    public:
+        /// scoped lock on the compile of an object, waits while another thread compiles the same object. Does nothing if Context::concurrentCompile isn't set.
+        class VSG_DECLSPEC Lock
+        {
+        public:
+            Lock(Context& context, const Object* object);
+            ~Lock();
+
+            Lock(const Lock&) = delete;
+            Lock& operator=(const Lock&) = delete;
+
+        protected:
+            Context& _context;
+            const Object* _object = nullptr;
+            size_t _numCommands = 0;
+            size_t _numBuildCommands = 0;
+        };
+
+        /// the batch signalling semaphore has been submitted and its subgraphs passed on to be merged, so the objects it compiled no longer need to be waited for.
+        void submitted(const Semaphore* semaphore);
+
+        /// return true if objects compiled by the batch signalling semaphore have transfers that haven't yet been submitted.
+        bool pending(const Semaphore* semaphore) const;
+
+    protected:
+        mutable std::mutex _mutex;
+        std::condition_variable _cv;
+        std::unordered_map<const Object*, std::thread::id> _compiling;
+        std::unordered_map<const Object*, ref_ptr<Semaphore>> _owners;
+    };
+    VSG_type_name(vsg::ConcurrentCompile);
+
     class Context
     {
     public:
@@ -85,6 +127,8 @@ namespace vsg
         ref_ptr<CommandBuffer> commandBuffer;
         ref_ptr<Fence> fence;
         ref_ptr<Semaphore> semaphore;
+
+        /// deprecated, no longer used by the VSG as ScratchMemory::threadLocal() and ScratchMemoryScope are used instead, kept for backwards compatibility.
         ref_ptr<ScratchMemory> scratchMemory;
 
         std::vector<ref_ptr<Command>> commands;
@@ -100,6 +144,12 @@ namespace vsg
         // raytracing
         VkDeviceSize scratchBufferSize;
         std::vector<ref_ptr<BuildAccelerationStructureCommand>> buildAccelerationStructureCommands;
+
+        /// set when several threads compile with Contexts sharing the same Device, see ConcurrentCompile.
+        ref_ptr<ConcurrentCompile> concurrentCompile;
+
+        /// semaphores of other threads' batches whose transfers the objects compiled with this Context depend on, filled in by ConcurrentCompile::Lock.
+        std::set<ref_ptr<Semaphore>> compileDependencies;
     };
 
 } // namespace vsg
@@ -59,6 +59,9 @@ namespace vsg
         using CopyQueue = std::deque<CopyPair>;
 
         CopyQueue bufferDataToCopy;
+
+        /// running total of bytes reserved by reserveBufferData() and reserveMemory(), not reduced on release so the difference between two readings gives the bytes reserved in between.
+        VkDeviceSize cumulativeReservedSize = 0;
     };
 
 } // namespace vsg
@@ -14,6 +14,8 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 
 #include <vsg/vk/Device.h>
 
+#include <condition_variable>
+
 namespace vsg
 {
     class VSG_DECLSPEC Semaphore : public Inherit<Object, Semaphore>
@@ -29,6 +31,12 @@ namespace vsg
 
         std::atomic_uint& numDependentSubmissions() { return _numDependentSubmissions; }
 
+        /// set numDependentSubmissions to zero and wake any threads blocked in waitForDependentSubmissions()
+        void resetDependentSubmissions();
+
+        /// block till numDependentSubmissions is zero, with timeout in nanoseconds, return true if there are no remaining dependent submissions.
+        bool waitForDependentSubmissions(uint64_t timeout);
+
         const VkSemaphore* data() const { return &_semaphore; }
 
         Device* getDevice() { return _device; }
@@ -40,6 +48,8 @@ namespace vsg
         VkSemaphore _semaphore;
         VkPipelineStageFlags _pipelineStageFlags = VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT;
         std::atomic_uint _numDependentSubmissions{0};
+        std::mutex _mutex;
+        std::condition_variable _cv;
         ref_ptr<Device> _device;
         ref_ptr<AllocationCallbacks> _allocator;
     };
@@ -14,6 +14,7 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 
 #include <vsg/commands/PushConstants.h>
 #include <vsg/maths/plane.h>
+#include <vsg/maths/transform.h>
 #include <vsg/state/ComputePipeline.h>
 #include <vsg/state/DescriptorSet.h>
 #include <vsg/state/GraphicsPipeline.h>
@@ -149,9 +150,41 @@ namespace vsg
             dirty = true;
         }
 
+        /** When true the matrix is recorded relative to the eye, for rendering planetary scale scenes without per tile local origin transforms.
+         *  The eye position in the matrix's local coordinates is computed in double precision and the translation removed from the matrix before it's converted to float,
+         *  the eye position is then split into high and low float parts that are packed into the matrix's otherwise constant translation column and w row, so the push constant stays 64 bytes:
+         *      modelview[3].xyz holds eyeHigh, vec3(modelview[0][3], modelview[1][3], modelview[2][3]) holds eyeLow and modelview[3][3] remains 1.0.
+         *  The vertex shader unpacks the eye position and restores the matrix's constant entries before use, with vertices split into high and low parts using vsg::split():
+         *      vec3 eyeHigh = pc.modelview[3].xyz;
+         *      vec3 eyeLow = vec3(pc.modelview[0][3], pc.modelview[1][3], pc.modelview[2][3]);
+         *      mat4 modelview = mat4(vec4(pc.modelview[0].xyz, 0.0), vec4(pc.modelview[1].xyz, 0.0), vec4(pc.modelview[2].xyz, 0.0), vec4(0.0, 0.0, 0.0, 1.0));
+         *      vec3 position = (inPositionHigh - eyeHigh) + (inPositionLow - eyeLow);
+         *      gl_Position = pc.projection * modelview * vec4(position, 1.0);
+         *  The flag applies to every pipeline recorded by the RecordTraversal that owns this State, there is no per subgraph toggle, and shaders that use the matrix directly won't render correctly,
+         *  so relativeToEye should only be enabled when all the pipelines the traversal records use shaders like the above.
+         *  The matrix is assumed to be composed of only scales, rotations and translations, and USE_DOUBLE_MATRIX_STACK is required for the subtraction to retain precision.*/
+        bool relativeToEye = false;
+
         inline void record(CommandBuffer& commandBuffer)
         {
-            if (dirty)
+            if (dirty && relativeToEye)
+            {
+                const auto& matrix = matrixStack.top();
+                auto eye = inverse_4x3(matrix)[3];
+
+                vec3 high, low;
+                split(dvec3(eye.x, eye.y, eye.z), high, low);
+
+                mat4 modelview(matrix);
+                modelview[3].set(high.x, high.y, high.z, 1.0f);
+                modelview[0][3] = low.x;
+                modelview[1][3] = low.y;
+                modelview[2][3] = low.z;
+
+                vkCmdPushConstants(commandBuffer, commandBuffer.getCurrentPipelineLayout(), stageFlags, offset, sizeof(modelview), modelview.data());
+                dirty = false;
+            }
+            else if (dirty)
             {
 #if USE_DOUBLE_MATRIX_STACK
                 // make sure matrix is a float matrix.
@@ -297,6 +330,13 @@ namespace vsg
         {
             return vsg::intersect(_frustumStack.top(), s);
         }
+
+        /// batch test of bounding spheres against the current frustum, setting visible[i] to 1 for spheres that are wholly or partially inside. Returns the number of visible spheres.
+        std::size_t intersect(const t_sphere<value_type>* spheres, std::size_t numSpheres, uint8_t* visible)
+        {
+            const auto& polytope = _frustumStack.top();
+            return vsg::intersect(polytope.data(), polytope.size(), spheres, numSpheres, visible);
+        }
     };
 
 } // namespace vsg
@@ -92,6 +92,8 @@ void BindIndexBuffer::write(Output& output) const
 
 void BindIndexBuffer::compile(Context& context)
 {
+    ConcurrentCompile::Lock lock(context, this);
+
     // nothing to compile
     if (!_indices) return;
 
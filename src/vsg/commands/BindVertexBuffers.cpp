@@ -70,6 +70,8 @@ void BindVertexBuffers::write(Output& output) const
 
 void BindVertexBuffers::compile(Context& context)
 {
+    ConcurrentCompile::Lock lock(context, this);
+
     // nothing to compile
     if (_arrays.empty()) return;
 
@@ -84,6 +84,10 @@ void CopyAndReleaseImageDataCommand::CopyData::record(CommandBuffer& commandBuff
                              0, nullptr,
                              1, &preCopyBarrier);
 
+        // batch the copies of all the mipmap levels into a single vkCmdCopyBufferToImage call.
+        ScratchMemoryScope scratchMemory;
+        auto regions = scratchMemory.allocate<VkBufferImageCopy>(mipLevels);
+
         uint32_t mipWidth = width;
         uint32_t mipHeight = height;
         uint32_t mipDepth = depth;
@@ -91,7 +95,8 @@ void CopyAndReleaseImageDataCommand::CopyData::record(CommandBuffer& commandBuff
         for (uint32_t mipLevel = 0; mipLevel < mipLevels; ++mipLevel)
         {
             // std::cout<<"   level = "<<mipLevel<<", mipWidth = "<<mipWidth<<", mipHeight = "<<mipHeight<<std::endl;
-            VkBufferImageCopy region = {};
+            VkBufferImageCopy& region = regions[mipLevel];
+            region = {};
             region.bufferOffset = source.offset + mipmapOffsets[mipLevel] * valueSize;
             region.bufferRowLength = 0;
             region.bufferImageHeight = 0;
@@ -102,13 +107,13 @@ void CopyAndReleaseImageDataCommand::CopyData::record(CommandBuffer& commandBuff
             region.imageOffset = {0, 0, 0};
             region.imageExtent = {mipWidth, mipHeight, mipDepth};
 
-            vkCmdCopyBufferToImage(commandBuffer, *imageStagingBuffer, *textureImage, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &region);
-
             if (mipWidth > 1) mipWidth /= 2;
             if (mipHeight > 1) mipHeight /= 2;
             if (mipDepth > 1) mipDepth /= 2;
         }
 
+        vkCmdCopyBufferToImage(commandBuffer, *imageStagingBuffer, *textureImage, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, mipLevels, regions);
+
         VkImageMemoryBarrier postCopyBarrier = {};
         postCopyBarrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
         postCopyBarrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
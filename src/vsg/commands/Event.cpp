@@ -109,7 +109,8 @@ WaitEvents::~WaitEvents()
 
 void WaitEvents::record(CommandBuffer& commandBuffer) const
 {
-    auto& scratchMemory = *(commandBuffer.scratchMemory);
+    ScratchMemoryScope scratch;
+    auto& scratchMemory = scratch.memory;
 
     auto vk_events = scratchMemory.allocate<VkEvent>(events.size());
     for (size_t i = 0; i < events.size(); ++i)
@@ -147,6 +148,4 @@ void WaitEvents::record(CommandBuffer& commandBuffer) const
         vk_bufferMemoryBarriers,
         static_cast<uint32_t>(imageMemoryBarriers.size()),
         vk_imageMemoryBarriers);
-
-    scratchMemory.release();
 }
@@ -95,7 +95,8 @@ PipelineBarrier::~PipelineBarrier()
 
 void PipelineBarrier::record(CommandBuffer& commandBuffer) const
 {
-    auto& scratchMemory = *(commandBuffer.scratchMemory);
+    ScratchMemoryScope scratch;
+    auto& scratchMemory = scratch.memory;
 
     auto vk_memoryBarriers = scratchMemory.allocate<VkMemoryBarrier>(memoryBarriers.size());
     for (size_t i = 0; i < memoryBarriers.size(); ++i)
@@ -125,6 +126,4 @@ void PipelineBarrier::record(CommandBuffer& commandBuffer) const
         vk_bufferMemoryBarriers,
         static_cast<uint32_t>(imageMemoryBarriers.size()),
         vk_imageMemoryBarriers);
-
-    scratchMemory.release();
 }
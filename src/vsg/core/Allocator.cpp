@@ -20,11 +20,13 @@ using namespace vsg;
 
 Allocator::~Allocator()
 {
+    if (!reportStatistics) return;
+
     std::cout << "Allocator::~Allocator() " << this << std::endl;
-    std::cout << "     _bytesAllocated = " << _bytesAllocated << std::endl;
-    std::cout << "     _countAllocated = " << _countAllocated << std::endl;
-    std::cout << "     _bytesDeallocated = " << _bytesDeallocated << std::endl;
-    std::cout << "     _countDellocated = " << _countDeallocated << std::endl;
+    std::cout << "     _bytesAllocated = " << _bytesAllocated.load() << std::endl;
+    std::cout << "     _countAllocated = " << _countAllocated.load() << std::endl;
+    std::cout << "     _bytesDeallocated = " << _bytesDeallocated.load() << std::endl;
+    std::cout << "     _countDellocated = " << _countDeallocated.load() << std::endl;
 }
 
 void* Allocator::allocate(std::size_t size, const void* hint)
@@ -54,27 +56,38 @@ void Allocator::deallocate(const void* ptr, std::size_t size)
 
 Auxiliary* Allocator::getOrCreateSharedAuxiliary()
 {
-    if (!_sharedAuxiliary)
-    {
-        void* ptr = allocate(sizeof(Auxiliary));
-        _sharedAuxiliary = new (ptr) Auxiliary(this);
-        std::cout << "Allocator::getOrCreateSharedAuxiliary() creating new : " << _sharedAuxiliary << std::endl;
-    }
-    else
+    std::scoped_lock lock(_sharedAuxiliaryMutex);
+    if (_sharedAuxiliary)
     {
-        std::cout << "Allocator::getOrCreateSharedAuxiliary() returning existing : " << _sharedAuxiliary << std::endl;
+        // only reuse the shared Auxiliary if it isn't already being destroyed by the unref() of the last object using it
+        unsigned int count = _sharedAuxiliary->_referenceCount.load();
+        while (count != 0)
+        {
+            if (_sharedAuxiliary->_referenceCount.compare_exchange_weak(count, count + 1)) return _sharedAuxiliary;
+        }
     }
+
+    void* ptr = allocate(sizeof(Auxiliary));
+    _sharedAuxiliary = new (ptr) Auxiliary(this);
+    _sharedAuxiliary->ref();
     return _sharedAuxiliary;
 }
 
+void Allocator::_attachSharedAuxiliary(Object* object)
+{
+    Auxiliary* auxiliary = getOrCreateSharedAuxiliary();
+    object->setAuxiliary(auxiliary);
+
+    // setAuxiliary() takes its own reference so release the one taken on our behalf by getOrCreateSharedAuxiliary()
+    auxiliary->unref();
+}
+
 void Allocator::detachSharedAuxiliary(Auxiliary* auxiliary)
 {
+    std::scoped_lock lock(_sharedAuxiliaryMutex);
     if (_sharedAuxiliary == auxiliary)
     {
-        std::cout << "Allocator::detachSharedAuxiliary(" << auxiliary << ") detecting auxiliary" << std::endl;
-    }
-    else
-    {
-        std::cout << "Allocator::detachSharedAuxiliary(" << auxiliary << ") auxiliary not matched" << std::endl;
+        // the shared Auxiliary is being destroyed so a new one will need to be created for subsequent objects
+        _sharedAuxiliary = nullptr;
     }
 }
@@ -0,0 +1,79 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2020 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/core/ArenaAllocator.h>
+
+using namespace vsg;
+
+ArenaAllocator::ArenaAllocator(std::size_t in_blockSize) :
+    blockSize(in_blockSize)
+{
+    reportStatistics = false;
+}
+
+ArenaAllocator::~ArenaAllocator()
+{
+    for (auto block : _blocks)
+    {
+        ::operator delete(block);
+    }
+}
+
+void* ArenaAllocator::allocate(std::size_t size, const void* /*hint*/)
+{
+    return allocate(size);
+}
+
+void* ArenaAllocator::allocate(std::size_t size)
+{
+    _bytesAllocated += size;
+    ++_countAllocated;
+
+    std::size_t alignedSize = ((size + alignment - 1) / alignment) * alignment;
+    if (alignedSize == 0) alignedSize = alignment;
+
+    std::scoped_lock lock(_mutex);
+
+    // allocations that are large relative to the block size get a block of their own so they don't waste the remainder of the current block
+    if (alignedSize > blockSize / 4)
+    {
+        void* ptr = ::operator new(alignedSize);
+        _blocks.push_back(ptr);
+        return ptr;
+    }
+
+    if (_current + alignedSize > _end)
+    {
+        // ::operator new returns memory aligned to at least alignof(std::max_align_t), so allocations are aligned to ArenaAllocator::alignment
+        auto block = static_cast<uint8_t*>(::operator new(blockSize));
+        _blocks.push_back(block);
+        _current = block;
+        _end = block + blockSize;
+    }
+
+    void* ptr = _current;
+    _current += alignedSize;
+    return ptr;
+}
+
+void ArenaAllocator::deallocate(const void* /*ptr*/, std::size_t size)
+{
+    // memory is only released when the ArenaAllocator is destroyed
+    _bytesDeallocated += size;
+    ++_countDeallocated;
+}
+
+std::size_t ArenaAllocator::numBlocks() const
+{
+    std::scoped_lock lock(_mutex);
+    return _blocks.size();
+}
@@ -108,16 +108,16 @@ void Auxiliary::resetConnectedObject()
     _connectedObject = 0;
 }
 
-void Auxiliary::setObject(const std::string& key, Object* object)
+void Auxiliary::setObject(const InternedString& key, Object* object)
 {
     _objectMap[key] = object;
-    DEBUG_NOTIFY << "Auxiliary::setObject( [" << key << "], " << object << ")"
+    DEBUG_NOTIFY << "Auxiliary::setObject( [" << key.str() << "], " << object << ")"
                  << " " << _objectMap.size() << " " << &_objectMap << std::endl;
 }
 
-Object* Auxiliary::getObject(const std::string& key)
+Object* Auxiliary::getObject(const InternedString& key)
 {
-    DEBUG_NOTIFY << "Auxiliary::getObject( [" << key << "])" << std::endl;
+    DEBUG_NOTIFY << "Auxiliary::getObject( [" << key.str() << "])" << std::endl;
     ObjectMap::iterator itr = _objectMap.find(key);
     if (itr != _objectMap.end())
         return itr->second.get();
@@ -125,9 +125,9 @@ Object* Auxiliary::getObject(const std::string& key)
         return nullptr;
 }
 
-const Object* Auxiliary::getObject(const std::string& key) const
+const Object* Auxiliary::getObject(const InternedString& key) const
 {
-    DEBUG_NOTIFY << "Auxiliary::getObject( [" << key << "]) const" << std::endl;
+    DEBUG_NOTIFY << "Auxiliary::getObject( [" << key.str() << "]) const" << std::endl;
     ObjectMap::const_iterator itr = _objectMap.find(key);
     if (itr != _objectMap.end())
         return itr->second.get();
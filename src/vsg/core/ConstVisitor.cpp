@@ -437,6 +437,10 @@ void ConstVisitor::apply(const CullGroup& value)
 {
     apply(static_cast<const Group&>(value));
 }
+void ConstVisitor::apply(const BVHGroup& value)
+{
+    apply(static_cast<const Group&>(value));
+}
 void ConstVisitor::apply(const CullNode& value)
 {
     apply(static_cast<const Node&>(value));
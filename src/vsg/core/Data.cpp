@@ -10,18 +10,44 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 
 </editor-fold> */
 
+#include <vsg/core/Allocator.h>
 #include <vsg/core/Data.h>
 #include <vsg/io/Input.h>
 #include <vsg/io/Options.h>
 #include <vsg/io/Output.h>
 
+#include <iostream>
+
 using namespace vsg;
 
+void* Data::_allocateFromAllocator(std::size_t size)
+{
+    auto allocator = getAllocator();
+    return allocator ? allocator->allocate(size) : nullptr;
+}
+
+void Data::_deallocateFromAllocator(void* ptr, std::size_t size)
+{
+    getAllocator()->deallocate(ptr, size);
+}
+
 void Data::read(Input& input)
 {
     Object::read(input);
 
-    if (input.version_greater_equal(0, 0, 1))
+    if (input.version_greater_equal(0, 0, 3))
+    {
+        uint32_t format = 0;
+        input.read("Layout", format, _layout.stride, _layout.maxNumMipmaps, _layout.blockWidth, _layout.blockHeight, _layout.blockDepth, _layout.origin, _layout.alignment);
+        _layout.format = VkFormat(format);
+
+        if (_validAlignment() != _layout.alignment)
+        {
+            std::cout << "Warning: Data::read() Layout::alignment of " << uint32_t(_layout.alignment) << " is not a power of two, using default alignment." << std::endl;
+            _layout.alignment = 0;
+        }
+    }
+    else if (input.version_greater_equal(0, 0, 1))
     {
         uint32_t format = 0;
         input.read("Layout", format, _layout.stride, _layout.maxNumMipmaps, _layout.blockWidth, _layout.blockHeight, _layout.blockDepth, _layout.origin);
@@ -38,7 +64,12 @@ void Data::write(Output& output) const
 {
     Object::write(output);
 
-    if (output.version_greater_equal(0, 0, 1))
+    if (output.version_greater_equal(0, 0, 3))
+    {
+        uint32_t format = _layout.format;
+        output.write("Layout", format, _layout.stride, _layout.maxNumMipmaps, _layout.blockWidth, _layout.blockHeight, _layout.blockDepth, _layout.origin, _layout.alignment);
+    }
+    else if (output.version_greater_equal(0, 0, 1))
     {
         uint32_t format = _layout.format;
         output.write("Layout", format, _layout.stride, _layout.maxNumMipmaps, _layout.blockWidth, _layout.blockHeight, _layout.blockDepth, _layout.origin);
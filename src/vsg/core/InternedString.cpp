@@ -0,0 +1,77 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2020 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/core/InternedString.h>
+
+#include <deque>
+#include <mutex>
+#include <shared_mutex>
+#include <string_view>
+#include <unordered_map>
+
+using namespace vsg;
+
+namespace
+{
+    struct InternTable
+    {
+        std::shared_mutex mutex;
+        std::deque<InternedString::Entry> entries; // deque so Entry addresses, and the string_view keys into them, remain stable as the table grows.
+        std::unordered_map<std::string_view, const InternedString::Entry*> lookup;
+
+        const InternedString::Entry* find(const std::string_view& str)
+        {
+            std::shared_lock<std::shared_mutex> lock(mutex);
+            auto itr = lookup.find(str);
+            return (itr != lookup.end()) ? itr->second : nullptr;
+        }
+
+        const InternedString::Entry* intern(const std::string_view& str)
+        {
+            if (auto entry = find(str)) return entry;
+
+            std::unique_lock<std::shared_mutex> lock(mutex);
+            if (auto itr = lookup.find(str); itr != lookup.end()) return itr->second;
+
+            auto& entry = entries.emplace_back(InternedString::Entry{std::string(str), static_cast<uint32_t>(entries.size() + 1)});
+            lookup[entry.str] = &entry;
+            return &entry;
+        }
+
+        static InternTable& instance()
+        {
+            static InternTable s_internTable;
+            return s_internTable;
+        }
+    };
+} // namespace
+
+InternedString::InternedString(const std::string& str) :
+    _entry(InternTable::instance().intern(str))
+{
+}
+
+InternedString::InternedString(const char* str) :
+    _entry(str ? InternTable::instance().intern(str) : nullptr)
+{
+}
+
+InternedString InternedString::find(const std::string& str)
+{
+    return InternedString(InternTable::instance().find(str));
+}
+
+const std::string& InternedString::str() const
+{
+    static const std::string s_empty;
+    return _entry ? _entry->str : s_empty;
+}
@@ -21,6 +21,8 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <vsg/io/Options.h>
 #include <vsg/io/Output.h>
 
+#include <algorithm>
+
 using namespace vsg;
 
 #if 1
@@ -159,7 +161,8 @@ void Object::read(Input& input)
         Auxiliary::ObjectMap& objectMap = getOrCreateUniqueAuxiliary()->getObjectMap();
         for (; numObjects > 0; --numObjects)
         {
-            std::string key = input.readValue<std::string>("Key");
+            // keys are interned so they remain in the global InternedString table for the lifetime of the application, see InternedString.
+            InternedString key(input.readValue<std::string>("Key"));
             input.readObject("Object", objectMap[key]);
         }
     }
@@ -171,11 +174,18 @@ void Object::write(Output& output) const
     {
         // we have a unique auxiliary, need to write out it's ObjectMap entries
         const Auxiliary::ObjectMap& objectMap = _auxiliary->getObjectMap();
-        output.writeValue<uint32_t>("NumUserObjects", objectMap.size());
-        for (auto& entry : objectMap)
+
+        // ObjectMap order depends on insertion and erase() order, so sort by key to keep the output deterministic
+        std::vector<const Auxiliary::ObjectMap::value_type*> entries;
+        entries.reserve(objectMap.size());
+        for (auto& entry : objectMap) entries.push_back(&entry);
+        std::sort(entries.begin(), entries.end(), [](auto lhs, auto rhs) { return lhs->first.str() < rhs->first.str(); });
+
+        output.writeValue<uint32_t>("NumUserObjects", entries.size());
+        for (auto entry : entries)
         {
-            output.write("Key", entry.first);
-            output.writeObject("Object", entry.second.get());
+            output.write("Key", entry->first.str());
+            output.writeObject("Object", entry->second.get());
         }
     }
     else
@@ -184,24 +194,24 @@ void Object::write(Output& output) const
     }
 }
 
-void Object::setObject(const std::string& key, Object* object)
+void Object::setObject(const InternedString& key, Object* object)
 {
     getOrCreateUniqueAuxiliary()->setObject(key, object);
 }
 
-Object* Object::getObject(const std::string& key)
+Object* Object::getObject(const InternedString& key)
 {
     if (!_auxiliary) return nullptr;
     return _auxiliary->getObject(key);
 }
 
-const Object* Object::getObject(const std::string& key) const
+const Object* Object::getObject(const InternedString& key) const
 {
     if (!_auxiliary) return nullptr;
     return _auxiliary->getObject(key);
 }
 
-void Object::removeObject(const std::string& key)
+void Object::removeObject(const InternedString& key)
 {
     if (_auxiliary)
     {
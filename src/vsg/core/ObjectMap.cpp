@@ -0,0 +1,86 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2020 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/core/ObjectMap.h>
+
+using namespace vsg;
+
+ObjectMap& ObjectMap::operator=(const ObjectMap& rhs)
+{
+    if (&rhs == this) return *this;
+
+    clear();
+    if (rhs._size > inlineCapacity)
+    {
+        _heap = rhs._heap;
+    }
+    else
+    {
+        std::copy(rhs.begin(), rhs.end(), _inline.begin());
+    }
+    _size = rhs._size;
+
+    return *this;
+}
+
+ref_ptr<Object>& ObjectMap::operator[](const InternedString& key)
+{
+    if (auto itr = find(key); itr != end()) return itr->second;
+
+    if (!_heap.empty())
+    {
+        _heap.emplace_back(key, nullptr);
+        return _heap[_size++].second;
+    }
+
+    if (_size < inlineCapacity)
+    {
+        _inline[_size] = value_type(key, nullptr);
+        return _inline[_size++].second;
+    }
+
+    // inline storage exhausted so move all the entries across to the heap
+    _heap.reserve(inlineCapacity * 2);
+    for (auto& entry : _inline)
+    {
+        _heap.emplace_back(entry.first, entry.second);
+        entry = value_type();
+    }
+
+    _heap.emplace_back(key, nullptr);
+    return _heap[_size++].second;
+}
+
+bool ObjectMap::erase(const InternedString& key)
+{
+    auto itr = find(key);
+    if (itr == end()) return false;
+
+    // move the last entry into the erased entry's place
+    auto last = end() - 1;
+    if (itr != last) *itr = *last;
+
+    if (_heap.empty())
+        *last = value_type();
+    else
+        _heap.pop_back();
+
+    --_size;
+    return true;
+}
+
+void ObjectMap::clear()
+{
+    for (auto& entry : _inline) entry = value_type();
+    _heap.clear();
+    _size = 0;
+}
@@ -0,0 +1,152 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2020 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/core/SlabAllocator.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <new>
+#include <thread>
+
+using namespace vsg;
+
+// each thread is assigned an arena index on first use, threads are distributed round robin across the arenas
+static std::atomic_uint32_t s_nextThreadIndex{0};
+static thread_local uint32_t s_threadIndex = s_nextThreadIndex++;
+
+static std::size_t powerOfTwoSlabSize(std::size_t size)
+{
+    // each slab needs room for its header and at least one block of the largest size class
+    std::size_t slabSize = 2 * SlabAllocator::maxSlabAllocationSize;
+    while (slabSize < size) slabSize <<= 1;
+    return slabSize;
+}
+
+SlabAllocator::SlabAllocator(std::size_t in_slabSize, uint32_t numArenas) :
+    slabSize(powerOfTwoSlabSize(in_slabSize)),
+    _numArenas(numArenas > 0 ? numArenas : std::max(1u, std::thread::hardware_concurrency())),
+    _arenas(new Arena[_numArenas])
+{
+    reportStatistics = false;
+}
+
+SlabAllocator::~SlabAllocator()
+{
+    // release all the slabs in bulk, any blocks still allocated are released with them
+    for (uint32_t i = 0; i < _numArenas; ++i)
+    {
+        for (auto slab : _arenas[i].slabs)
+        {
+            ::operator delete(slab, std::align_val_t(slabSize));
+        }
+    }
+}
+
+SlabAllocator::Arena& SlabAllocator::_arena()
+{
+    return _arenas[s_threadIndex % _numArenas];
+}
+
+const SlabAllocator::SlabHeader* SlabAllocator::_slabHeader(const void* ptr) const
+{
+    return reinterpret_cast<const SlabHeader*>(reinterpret_cast<std::uintptr_t>(ptr) & ~(std::uintptr_t(slabSize) - 1));
+}
+
+bool SlabAllocator::_isSlabBlock(const void* ptr) const
+{
+    const void* slab = _slabHeader(ptr);
+    for (uint32_t i = 0; i < _numArenas; ++i)
+    {
+        auto& arena = _arenas[i];
+        std::scoped_lock lock(arena.mutex);
+        if (std::find(arena.slabs.begin(), arena.slabs.end(), slab) != arena.slabs.end()) return true;
+    }
+    return false;
+}
+
+void* SlabAllocator::allocate(std::size_t size, const void* /*hint*/)
+{
+    return allocate(size);
+}
+
+void* SlabAllocator::allocate(std::size_t size)
+{
+    _bytesAllocated += size;
+    ++_countAllocated;
+
+    if (size == 0 || size > maxSlabAllocationSize) return ::operator new(size);
+
+    std::size_t index = (size - 1) / alignment;
+    std::size_t blockSize = (index + 1) * alignment;
+
+    auto& arena = _arena();
+    std::scoped_lock lock(arena.mutex);
+
+    auto& sizeClass = arena.sizeClasses[index];
+    if (sizeClass.freeList)
+    {
+        FreeBlock* block = sizeClass.freeList;
+        sizeClass.freeList = block->next;
+        return block;
+    }
+
+    if (sizeClass.current + blockSize > sizeClass.end)
+    {
+        // slabs are aligned to slabSize so that deallocate() can find the slab header from a block's address
+        auto slab = static_cast<uint8_t*>(::operator new(slabSize, std::align_val_t(slabSize)));
+        new (slab) SlabHeader{index};
+        arena.slabs.push_back(slab);
+        sizeClass.current = slab + alignment;
+        sizeClass.end = sizeClass.current + ((slabSize - alignment) / blockSize) * blockSize;
+    }
+
+    void* ptr = sizeClass.current;
+    sizeClass.current += blockSize;
+    return ptr;
+}
+
+void SlabAllocator::deallocate(const void* ptr, std::size_t size)
+{
+    if (!ptr) return;
+
+    _bytesDeallocated += size;
+    ++_countDeallocated;
+
+    if (size > maxSlabAllocationSize || (size == 0 && !_isSlabBlock(ptr)))
+    {
+        ::operator delete(const_cast<void*>(ptr));
+        return;
+    }
+
+    // blocks freed by any thread go on the calling thread's arena free list, as all the arenas' slabs are released together this doesn't need to be the arena it was allocated from
+    std::size_t index = _slabHeader(ptr)->sizeClass;
+
+    auto& arena = _arena();
+    std::scoped_lock lock(arena.mutex);
+
+    auto& sizeClass = arena.sizeClasses[index];
+    auto block = static_cast<FreeBlock*>(const_cast<void*>(ptr));
+    block->next = sizeClass.freeList;
+    sizeClass.freeList = block;
+}
+
+std::size_t SlabAllocator::numSlabs() const
+{
+    std::size_t count = 0;
+    for (uint32_t i = 0; i < _numArenas; ++i)
+    {
+        std::scoped_lock lock(_arenas[i].mutex);
+        count += _arenas[i].slabs.size();
+    }
+    return count;
+}
@@ -437,6 +437,10 @@ void Visitor::apply(CullGroup& value)
 {
     apply(static_cast<Group&>(value));
 }
+void Visitor::apply(BVHGroup& value)
+{
+    apply(static_cast<Group&>(value));
+}
 void Visitor::apply(CullNode& value)
 {
     apply(static_cast<Node&>(value));
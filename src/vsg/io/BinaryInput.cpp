@@ -10,6 +10,7 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 
 </editor-fold> */
 
+#include <vsg/core/ArenaAllocator.h>
 #include <vsg/io/BinaryInput.h>
 #include <vsg/io/ReaderWriter.h>
 
@@ -23,6 +24,7 @@ BinaryInput::BinaryInput(std::istream& input, ref_ptr<ObjectFactory> in_objectFa
     Input(in_objectFactory, in_options),
     _input(input)
 {
+    if (options && options->arenaAllocation) allocator = ref_ptr<Allocator>(new ArenaAllocator());
 }
 
 void BinaryInput::_read(std::string& value)
@@ -56,6 +58,25 @@ vsg::ref_ptr<vsg::Object> BinaryInput::read()
     {
         return itr->second;
     }
+    else if (version_greater_equal(0, 0, 2))
+    {
+        vsg::ref_ptr<vsg::Object> object;
+        if (auto className = _readClassName())
+        {
+            object = objectFactory->create(className, allocator.get());
+            if (object)
+            {
+                object->read(*this);
+            }
+            else
+            {
+                std::cout << "Unable to create instance of class : " << className.str() << std::endl;
+            }
+        }
+
+        objectIDMap[id] = object;
+        return object;
+    }
     else
     {
         std::string className = readValue<std::string>(nullptr);
@@ -63,7 +84,7 @@ vsg::ref_ptr<vsg::Object> BinaryInput::read()
         vsg::ref_ptr<vsg::Object> object;
         if (className != "nullptr")
         {
-            object = objectFactory->create(className.c_str());
+            object = objectFactory->create(className, allocator.get());
             if (object)
             {
                 object->read(*this);
@@ -78,3 +99,21 @@ vsg::ref_ptr<vsg::Object> BinaryInput::read()
         return object;
     }
 }
+
+InternedString BinaryInput::_readClassName()
+{
+    uint32_t index = readValue<uint32_t>(nullptr);
+    if (index == 0) return {};
+
+    if (index == _classNames.size() + 1)
+    {
+        _classNames.emplace_back(readValue<std::string>(nullptr));
+    }
+    else if (index > _classNames.size())
+    {
+        std::cout << "Warning: BinaryInput::_readClassName() invalid class name index : " << index << std::endl;
+        return {};
+    }
+
+    return _classNames[index - 1];
+}
@@ -55,7 +55,13 @@ void BinaryOutput::write(const vsg::Object* object)
     objectIDMap[object] = id;
 
     _output.write(reinterpret_cast<const char*>(&id), sizeof(id));
-    if (object)
+
+    if (version_greater_equal(0, 0, 2))
+    {
+        _writeClassName(object ? object->className() : nullptr);
+        if (object) object->write(*this);
+    }
+    else if (object)
     {
         _write(std::string(object->className()));
         object->write(*this);
@@ -65,3 +71,27 @@ void BinaryOutput::write(const vsg::Object* object)
         _write(std::string("nullptr"));
     }
 }
+
+void BinaryOutput::_writeClassName(const char* className)
+{
+    uint32_t index = 0;
+    if (className)
+    {
+        if (auto itr = _classNameIndices.find(className); itr != _classNameIndices.end())
+        {
+            index = itr->second;
+        }
+        else
+        {
+            // first time className has been written so follow the new index with the string
+            index = static_cast<uint32_t>(_classNameIndices.size() + 1);
+            _classNameIndices[className] = index;
+
+            _output.write(reinterpret_cast<const char*>(&index), sizeof(index));
+            _write(std::string(className));
+            return;
+        }
+    }
+
+    _output.write(reinterpret_cast<const char*>(&index), sizeof(index));
+}
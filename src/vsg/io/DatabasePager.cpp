@@ -10,18 +10,235 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 
 </editor-fold> */
 
+#include <vsg/commands/BindIndexBuffer.h>
+#include <vsg/commands/BindVertexBuffers.h>
 #include <vsg/io/DatabasePager.h>
 #include <vsg/io/read.h>
+#include <vsg/nodes/Geometry.h>
+#include <vsg/nodes/VertexIndexDraw.h>
+#include <vsg/state/DescriptorBuffer.h>
+#include <vsg/state/DescriptorImage.h>
+#include <vsg/state/StateGroup.h>
 #include <vsg/threading/atomics.h>
 #include <vsg/ui/ApplicationEvent.h>
 
 #include <iostream>
+#include <set>
 
 using namespace vsg;
 
 #define DO_TIMING 0
 #define REPORT_STATS 0
 
+static VkDeviceSize computeHostMemorySize(const ref_ptr<Node>& subgraph)
+{
+    if (!subgraph) return 0;
+
+    // sum the Data payloads referenced by the subgraph, these are retained in host memory for the lifetime of the subgraph, unlike the staging buffers used to upload them.
+    struct ComputeHostMemorySize : public ConstVisitor
+    {
+        VkDeviceSize size = 0;
+        std::set<const Data*> visited;
+
+        void apply(const Object& object) override
+        {
+            object.traverse(*this);
+        }
+
+        void apply(const Data& data) override
+        {
+            if (visited.insert(&data).second) size += data.dataSize();
+        }
+
+        void apply(const PagedLOD& plod) override
+        {
+            // nested high res subgraphs are paged, and accounted for, independently
+            if (auto& lowres = plod.getChild(1).node) lowres->accept(*this);
+        }
+
+        void apply(const StateGroup& stateGroup) override
+        {
+            for (auto& stateCommand : stateGroup.getStateCommands()) stateCommand->accept(*this);
+            stateGroup.traverse(*this);
+        }
+
+        void apply(const Geometry& geometry) override
+        {
+            applyArrays(geometry.arrays, geometry.indices);
+            geometry.traverse(*this);
+        }
+
+        void apply(const VertexIndexDraw& vid) override
+        {
+            applyArrays(vid.arrays, vid.indices);
+        }
+
+        void apply(const BindVertexBuffers& bvb) override
+        {
+            applyArrays(bvb.getArrays(), {});
+        }
+
+        void apply(const BindIndexBuffer& bib) override
+        {
+            if (auto indices = bib.getIndices()) indices->accept(*this);
+        }
+
+        void apply(const Descriptor& descriptor) override
+        {
+            if (auto db = descriptor.cast<DescriptorBuffer>())
+            {
+                for (auto& data : db->getDataList()) data->accept(*this);
+            }
+            else if (auto di = descriptor.cast<DescriptorImage>())
+            {
+                for (auto& samplerImage : di->getSamplerImages())
+                {
+                    if (samplerImage.data) samplerImage.data->accept(*this);
+                }
+            }
+        }
+
+        void applyArrays(const DataList& arrays, const ref_ptr<Data>& indices)
+        {
+            for (auto& array : arrays)
+            {
+                if (array) array->accept(*this);
+            }
+            if (indices) indices->accept(*this);
+        }
+    } computeHostMemorySize;
+
+    subgraph->accept(computeHostMemorySize);
+    return computeHostMemorySize.size;
+}
+
+/////////////////////////////////////////////////////////////////////////
+//
+// LatencyHistogram
+//
+void LatencyHistogram::add(clock::duration duration)
+{
+    auto microseconds = static_cast<uint64_t>(std::max(std::chrono::duration_cast<std::chrono::microseconds>(duration).count(), std::chrono::microseconds::rep(0)));
+
+    // bucket is the number of significant bits, clamped to the last bucket
+    std::size_t bucket = 0;
+    while (bucket < (numBuckets - 1) && (microseconds >> bucket) != 0) ++bucket;
+
+    buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+    count.fetch_add(1, std::memory_order_relaxed);
+    totalMicroseconds.fetch_add(microseconds, std::memory_order_relaxed);
+    exchange_if_greater(maximumMicroseconds, microseconds);
+}
+
+double LatencyHistogram::average() const
+{
+    auto numDurations = count.load(std::memory_order_relaxed);
+    return numDurations > 0 ? (double(totalMicroseconds.load(std::memory_order_relaxed)) / double(numDurations)) * 0.001 : 0.0;
+}
+
+double LatencyHistogram::percentile(double ratio) const
+{
+    auto numDurations = count.load(std::memory_order_relaxed);
+    if (numDurations == 0) return 0.0;
+
+    double target = ratio * double(numDurations);
+    uint64_t cumulative = 0;
+    for (std::size_t bucket = 0; bucket < (numBuckets - 1); ++bucket)
+    {
+        cumulative += buckets[bucket].load(std::memory_order_relaxed);
+        if (double(cumulative) >= target) return double(uint64_t(1) << bucket) * 0.001;
+    }
+    return double(maximumMicroseconds.load(std::memory_order_relaxed)) * 0.001;
+}
+
+void LatencyHistogram::reset()
+{
+    for (auto& bucket : buckets) bucket.store(0);
+    count.store(0);
+    totalMicroseconds.store(0);
+    maximumMicroseconds.store(0);
+}
+
+/////////////////////////////////////////////////////////////////////////
+//
+// DatabasePagerStats
+//
+DatabasePagerStats::DatabasePagerStats()
+{
+}
+
+void DatabasePagerStats::update(time_point time, uint32_t numRequestsQueued, uint32_t numCompilesQueued, uint32_t numMergesQueued)
+{
+    requestQueueSize.store(numRequestsQueued, std::memory_order_relaxed);
+    compileQueueSize.store(numCompilesQueued, std::memory_order_relaxed);
+    mergeQueueSize.store(numMergesQueued, std::memory_order_relaxed);
+
+    auto currentBytesRead = bytesRead.load(std::memory_order_relaxed);
+    auto currentNumCompiled = numCompiled.load(std::memory_order_relaxed);
+
+    if (_rateStartTime == time_point())
+    {
+        _rateStartTime = time;
+        _rateStartBytesRead = currentBytesRead;
+        _rateStartNumCompiled = currentNumCompiled;
+        return;
+    }
+
+    double duration = std::chrono::duration<double, std::chrono::seconds::period>(time - _rateStartTime).count();
+    if (duration >= rateInterval && duration > 0.0)
+    {
+        bytesReadPerSecond.store(double(currentBytesRead - _rateStartBytesRead) / duration, std::memory_order_relaxed);
+        compilesPerSecond.store(double(currentNumCompiled - _rateStartNumCompiled) / duration, std::memory_order_relaxed);
+
+        _rateStartTime = time;
+        _rateStartBytesRead = currentBytesRead;
+        _rateStartNumCompiled = currentNumCompiled;
+    }
+}
+
+void DatabasePagerStats::reset()
+{
+    requestToRead.reset();
+    read.reset();
+    readToCompile.reset();
+    compile.reset();
+    compileToMerge.reset();
+    requestToMerge.reset();
+
+    numRequests.store(0);
+    numRead.store(0);
+    numCompiled.store(0);
+    numMerged.store(0);
+    numDiscarded.store(0);
+    numExpired.store(0);
+    numHighResMissing.store(0);
+    numCoalescedReads.store(0);
+    bytesRead.store(0);
+    bytesCompiled.store(0);
+
+    bytesReadPerSecond.store(0.0);
+    compilesPerSecond.store(0.0);
+    _rateStartTime = time_point();
+}
+
+void DatabasePagerStats::print(std::ostream& out) const
+{
+    auto print_histogram = [&out](const char* name, const LatencyHistogram& histogram) {
+        out << "    " << name << " count = " << histogram.count.load() << ", average = " << histogram.average() << "ms, 50% = " << histogram.percentile(0.5) << "ms, 95% = " << histogram.percentile(0.95) << "ms, max = " << (double(histogram.maximumMicroseconds.load()) * 0.001) << "ms" << std::endl;
+    };
+
+    out << "DatabasePagerStats" << std::endl;
+    out << "    queues : request = " << requestQueueSize.load() << ", compile = " << compileQueueSize.load() << ", merge = " << mergeQueueSize.load() << std::endl;
+    print_histogram("requestToRead", requestToRead);
+    print_histogram("read", read);
+    print_histogram("readToCompile", readToCompile);
+    print_histogram("compile", compile);
+    print_histogram("compileToMerge", compileToMerge);
+    print_histogram("requestToMerge", requestToMerge);
+    out << "    numRequests = " << numRequests.load() << ", numRead = " << numRead.load() << ", numCompiled = " << numCompiled.load() << ", numMerged = " << numMerged.load() << ", numDiscarded = " << numDiscarded.load() << ", numExpired = " << numExpired.load() << ", numHighResMissing = " << numHighResMissing.load() << ", numCoalescedReads = " << numCoalescedReads.load() << std::endl;
+    out << "    bytesRead = " << bytesRead.load() << ", bytesCompiled = " << bytesCompiled.load() << ", bytesReadPerSecond = " << bytesReadPerSecond.load() << ", compilesPerSecond = " << compilesPerSecond.load() << std::endl;
+}
+
 /////////////////////////////////////////////////////////////////////////
 //
 // DatabasePager
@@ -40,14 +257,14 @@ void DatabaseQueue::add(ref_ptr<PagedLOD> plod)
     // std::cout<<"DatabaseQueue::add("<<plod<<") status = "<<plod->requestStatus.load()<<std::endl;
 
     std::scoped_lock lock(_mutex);
-    _queue.emplace_back(plod);
+    _push(plod);
     _cv.notify_one();
 }
 
 void DatabaseQueue::add_then_reset(ref_ptr<PagedLOD>& plod)
 {
     std::scoped_lock lock(_mutex);
-    _queue.emplace_back(plod);
+    _push(plod);
     _cv.notify_one();
     plod = nullptr;
 }
@@ -56,85 +273,275 @@ void DatabaseQueue::add(Nodes& nodes)
 {
     std::scoped_lock lock(_mutex);
 
-    _queue.insert(_queue.end(), nodes.begin(), nodes.end());
+    for (auto& plod : nodes)
+    {
+        _push(plod);
+    }
 
-    _cv.notify_one();
+    if (nodes.size() == 1)
+        _cv.notify_one();
+    else if (nodes.size() > 1)
+        _cv.notify_all();
+}
+
+void DatabaseQueue::release()
+{
+    std::scoped_lock lock(_mutex);
+    _cv.notify_all();
+}
+
+void DatabaseQueue::updatePriority(const PagedLOD* plod)
+{
+    std::scoped_lock lock(_mutex);
+
+    // check the plod is still in this queue as it may have been taken since the caller last checked it's requestStatus
+    uint32_t pos = plod->queueIndex;
+    if (pos >= _heap.size() || _heap[pos].plod != plod) return;
+
+    double priority = plod->priority.load();
+    if (priority > _heap[pos].priority)
+    {
+        _heap[pos].priority = priority;
+        _moveUp(pos);
+    }
 }
 
 ref_ptr<PagedLOD> DatabaseQueue::take_when_available()
 {
-    //std::cout<<"DatabaseQueue::take_when_available() A _identifier = "<<_identifier<<" size = "<<_queue.size()<<std::endl;
+    //std::cout<<"DatabaseQueue::take_when_available() A _identifier = "<<_identifier<<" size = "<<_heap.size()<<std::endl;
 
-    std::chrono::duration waitDuration = std::chrono::milliseconds(100);
     std::unique_lock lock(_mutex);
 
-    // wait to the conditional variable signals that an operation has been added
-    while (_queue.empty() && _status->active())
+    // park till add() signals that a PagedLOD has been added or release() signals that the status has been cancelled
+    _cv.wait(lock, [&]() { return !_heap.empty() || _status->cancel(); });
+
+    // if the threads we are associated with should no longer running go for a quick exit and return nothing.
+    if (_heap.empty() || _status->cancel())
     {
-        //std::cout<<"   Waiting on condition variable B _identifier = "<<_identifier<<" size = "<<_queue.size()<<std::endl;
-        _cv.wait_for(lock, waitDuration);
+        //std::cout<<"DatabaseQueue::take_when_available() C _identifier = "<<_identifier<<" empty"<<std::endl;
+        return {};
     }
 
+    // remove and return the PagedLOD with the highest priority
+    return _pop();
+}
+
+DatabaseQueue::Nodes DatabaseQueue::take_all_when_available()
+{
+    std::unique_lock lock(_mutex);
+
+    // park till add() signals that a PagedLOD has been added or release() signals that the status has been cancelled
+    _cv.wait(lock, [&]() { return !_heap.empty() || _status->cancel(); });
+
     // if the threads we are associated with should no longer running go for a quick exit and return nothing.
-    if (_queue.empty() || _status->cancel())
+    if (_status->cancel())
     {
-        //std::cout<<"DatabaseQueue::take_when_available() C _identifier = "<<_identifier<<" empty"<<std::endl;
         return {};
     }
 
-    //std::cout<<"DatabaseQueue::take_when_available() D _identifier = "<<_identifier<<" "<<_queue.size()<<std::endl;
+    //std::cout<<"DatabaseQueue::take_all_when_avilable() "<<_heap.size()<<std::endl;
 
-#if 1
+    return _take_all();
+}
+
+DatabaseQueue::Nodes DatabaseQueue::take_share_when_available(uint32_t numShares, uint32_t maxNumNodes)
+{
+    std::unique_lock lock(_mutex);
 
-    // find the OagedLOD with the highest priority;
-    auto itr = _queue.begin();
-    auto highest_itr = itr++;
+    // park till add() signals that a PagedLOD has been added or release() signals that the status has been cancelled
+    _cv.wait(lock, [&]() { return !_heap.empty() || _status->cancel(); });
 
-    for (; itr != _queue.end(); ++itr)
+    if (_status->cancel())
     {
-        if ((*highest_itr)->priority > (*itr)->priority) highest_itr = itr;
+        return {};
     }
 
-    ref_ptr<PagedLOD> plod = *highest_itr;
-    _queue.erase(highest_itr);
+    size_t numNodes = (_heap.size() + std::max(numShares, 1u) - 1) / std::max(numShares, 1u);
+    if (maxNumNodes > 0 && numNodes > maxNumNodes) numNodes = maxNumNodes;
 
-    //std::cout<<"Returning "<<plod.get()<<std::dec<<" variable _identifier = "<<_identifier<<" size = "<<_queue.size()<<std::endl;
+    if (numNodes >= _heap.size()) return _take_all();
 
-#else
-    // remove and return the head of the queue
-    ref_ptr<PagedLOD> plod = _queue.front();
-    _queue.erase(_queue.begin());
-#endif
-    return plod;
+    Nodes nodes;
+    nodes.reserve(numNodes);
+    for (size_t i = 0; i < numNodes; ++i)
+    {
+        nodes.emplace_back(_pop());
+    }
+
+    // hand the remaining PagedLOD on to another waiting thread
+    _cv.notify_one();
+
+    return nodes;
 }
 
-DatabaseQueue::Nodes DatabaseQueue::take_all_when_available()
+ref_ptr<PagedLOD> DatabaseQueue::take()
 {
-    std::chrono::duration waitDuration = std::chrono::milliseconds(100);
+    std::scoped_lock lock(_mutex);
+    if (_heap.empty()) return {};
+    return _pop();
+}
 
-    std::unique_lock lock(_mutex);
+DatabaseQueue::Nodes DatabaseQueue::take_all()
+{
+    std::scoped_lock lock(_mutex);
+    return _take_all();
+}
+
+DatabaseQueue::Nodes DatabaseQueue::take_stale(uint64_t frameCount)
+{
+    Nodes nodes;
+
+    std::scoped_lock lock(_mutex);
 
-    // wait to the conditional variable signals that an operation has been added
-    while (_queue.empty() && _status->active())
+    // compact the entries still required to the front of the heap
+    uint32_t size = static_cast<uint32_t>(_heap.size());
+    uint32_t numRequired = 0;
+    for (uint32_t pos = 0; pos < size; ++pos)
     {
-        //std::cout<<"take_all_when_available() _identifier = "<<_identifier<<" Waiting on condition variable"<<_queue.size()<<std::endl;
-        _cv.wait_for(lock, waitDuration);
+        auto& entry = _heap[pos];
+        if (entry.plod->highResRequired(frameCount))
+        {
+            if (pos != numRequired) _assign(numRequired, std::move(entry));
+            ++numRequired;
+        }
+        else
+        {
+            entry.plod->queueIndex = 0;
+            nodes.emplace_back(std::move(entry.plod));
+        }
     }
 
-    // if the threads we are associated with should no longer running go for a quick exit and return nothing.
-    if (_status->cancel())
+    if (nodes.empty()) return nodes;
+
+    // restore the heap ordering
+    _heap.resize(numRequired);
+    for (uint32_t pos = numRequired / 2; pos > 0; --pos)
     {
-        return {};
+        _moveDown(pos - 1);
+    }
+
+    return nodes;
+}
+
+DatabaseQueue::Nodes DatabaseQueue::take_batch(const Semaphore* semaphore)
+{
+    Nodes nodes;
+    if (!semaphore) return nodes;
+
+    std::scoped_lock lock(_mutex);
+
+    // compact the entries from other batches to the front of the heap
+    uint32_t size = static_cast<uint32_t>(_heap.size());
+    uint32_t numRemaining = 0;
+    for (uint32_t pos = 0; pos < size; ++pos)
+    {
+        auto& entry = _heap[pos];
+        if (entry.plod->semaphore != semaphore)
+        {
+            if (pos != numRemaining) _assign(numRemaining, std::move(entry));
+            ++numRemaining;
+        }
+        else
+        {
+            entry.plod->queueIndex = 0;
+            nodes.emplace_back(std::move(entry.plod));
+        }
+    }
+
+    if (nodes.empty()) return nodes;
+
+    // restore the heap ordering
+    _heap.resize(numRemaining);
+    for (uint32_t pos = numRemaining / 2; pos > 0; --pos)
+    {
+        _moveDown(pos - 1);
+    }
+
+    return nodes;
+}
+
+void DatabaseQueue::_push(ref_ptr<PagedLOD> plod)
+{
+    uint32_t pos = static_cast<uint32_t>(_heap.size());
+    _heap.push_back(Entry{plod->priority.load(), plod});
+    plod->queueIndex = pos;
+    _moveUp(pos);
+}
+
+ref_ptr<PagedLOD> DatabaseQueue::_pop()
+{
+    ref_ptr<PagedLOD> plod = std::move(_heap.front().plod);
+
+    uint32_t last = static_cast<uint32_t>(_heap.size()) - 1;
+    if (last > 0)
+    {
+        _assign(0, std::move(_heap[last]));
+        _heap.pop_back();
+        _moveDown(0);
+    }
+    else
+    {
+        _heap.pop_back();
     }
 
-    //std::cout<<"DatabaseQueue::take_all_when_avilable() "<<_queue.size()<<std::endl;
+    plod->queueIndex = 0;
+    return plod;
+}
 
-    // remove and return the head of the queue
+DatabaseQueue::Nodes DatabaseQueue::_take_all()
+{
     Nodes nodes;
-    nodes.swap(_queue);
+    nodes.reserve(_heap.size());
+    for (auto& entry : _heap)
+    {
+        entry.plod->queueIndex = 0;
+        nodes.emplace_back(std::move(entry.plod));
+    }
+    _heap.clear();
     return nodes;
 }
 
+void DatabaseQueue::_moveUp(uint32_t pos)
+{
+    if (pos == 0) return;
+
+    Entry entry = std::move(_heap[pos]);
+    while (pos > 0)
+    {
+        uint32_t parent = (pos - 1) / 2;
+        if (_heap[parent].priority >= entry.priority) break;
+
+        _assign(pos, std::move(_heap[parent]));
+        pos = parent;
+    }
+    _assign(pos, std::move(entry));
+}
+
+void DatabaseQueue::_moveDown(uint32_t pos)
+{
+    uint32_t size = static_cast<uint32_t>(_heap.size());
+    Entry entry = std::move(_heap[pos]);
+    for (;;)
+    {
+        uint32_t child = pos * 2 + 1;
+        if (child >= size) break;
+
+        // select the child with the highest priority
+        if ((child + 1) < size && _heap[child + 1].priority > _heap[child].priority) ++child;
+        if (entry.priority >= _heap[child].priority) break;
+
+        _assign(pos, std::move(_heap[child]));
+        pos = child;
+    }
+    _assign(pos, std::move(entry));
+}
+
+void DatabaseQueue::_assign(uint32_t pos, Entry&& entry)
+{
+    entry.plod->queueIndex = pos;
+    _heap[pos] = std::move(entry);
+}
+
 /////////////////////////////////////////////////////////////////////////
 //
 // DatabasePager
@@ -144,6 +551,7 @@ DatabasePager::DatabasePager()
     if (!_status) _status = ActivityStatus::create();
 
     culledPagedLODs = CulledPagedLODs::create();
+    stats = DatabasePagerStats::create();
 
     _requestQueue = DatabaseQueue::create(_status);
     _compileQueue = DatabaseQueue::create(_status);
@@ -158,6 +566,11 @@ DatabasePager::~DatabasePager()
 
     _status->set(false);
 
+    // wake the read and compile threads parked on the queues so they can exit
+    _requestQueue->release();
+    _compileQueue->release();
+    _toMergeQueue->release();
+
     for (auto& thread : _readThreads)
     {
         thread.join();
@@ -171,32 +584,44 @@ DatabasePager::~DatabasePager()
 
 void DatabasePager::start()
 {
-    int numReadThreads = 4;
-    int numCompileThreads = 1;
-
     //
     // set up read thread(s)
     //
     auto read = [](ref_ptr<DatabaseQueue> requestQueue, ref_ptr<DatabaseQueue> compileQueue, ref_ptr<ActivityStatus> status, DatabasePager& databasePager) {
         //std::cout<<"Started DatabaseThread read thread"<<std::endl;
 
+        if (databasePager.readThreadAffinity) setAffinity(databasePager.readThreadAffinity);
+
         while (status->active())
         {
             auto plod = requestQueue->take_when_available();
             if (plod)
             {
-                uint64_t frameDelta = databasePager.frameCount - plod->frameHighResLastUsed.load();
-                if (frameDelta > 1 || !compare_exchange(plod->requestStatus, PagedLOD::ReadRequest, PagedLOD::Reading))
+                if (!plod->highResRequired(databasePager.frameCount) || !compare_exchange(plod->requestStatus, PagedLOD::ReadRequest, PagedLOD::Reading))
                 {
                     // std::cout<<"Expire read request"<<std::endl;
-                    databasePager.requestDiscarded(plod);
+                    databasePager.readDiscarded(plod);
                     continue;
                 }
 
                 //std::cout<<"    reading "<<plod->filename<<", "<<plod->requestCount.load()<<std::endl;
 
+                auto& pagerStats = *databasePager.stats;
+                auto startReadTime = clock::now();
+                pagerStats.requestToRead.add(startReadTime - plod->requestTime);
+
                 auto subgraph = vsg::read_cast<vsg::Node>(plod->filename, plod->options);
 
+                plod->readTime = clock::now();
+                pagerStats.read.add(plod->readTime - startReadTime);
+                ++pagerStats.numRead;
+                if (pagerStats.measureBytesRead)
+                {
+                    if (auto foundFile = findFile(plod->filename, plod->options); !foundFile.empty()) pagerStats.bytesRead += fileSize(foundFile);
+                }
+
+                databasePager.readCompleted(plod, subgraph);
+
                 // std::cout<<"    finished reading "<<plod->filename<<", "<<plod->requestCount.load()<<std::endl;
 
                 if (subgraph && compare_exchange(plod->requestStatus, PagedLOD::Reading, PagedLOD::CompileRequest))
@@ -212,14 +637,14 @@ void DatabasePager::start()
                 }
                 else
                 {
-                    databasePager.requestDiscarded(plod);
+                    databasePager.readDiscarded(plod);
                 }
             }
         }
         //std::cout<<"Finished DatabaseThread read thread"<<std::endl;
     };
 
-    for (int i = 0; i < numReadThreads; ++i)
+    for (uint32_t i = 0; i < numReadThreads; ++i)
     {
         _readThreads.emplace_back(read, std::ref(_requestQueue), std::ref(_compileQueue), std::ref(_status), std::ref(*this));
     }
@@ -227,16 +652,72 @@ void DatabasePager::start()
     //
     // set up compile thread(s)
     //
-    auto compile = [](ref_ptr<DatabaseQueue> compileQueue, ref_ptr<DatabaseQueue> toMergeQueue, ref_ptr<CompileTraversal> db_ct, ref_ptr<ActivityStatus> status, DatabasePager& databasePager) {
+    auto compile = [](ref_ptr<DatabaseQueue> compileQueue, ref_ptr<DatabaseQueue> toMergeQueue, ref_ptr<CompileTraversal> db_ct, uint32_t numCompileContexts, ref_ptr<ActivityStatus> status, DatabasePager& databasePager) {
         //std::cout<<"Started DatabaseThread compile thread"<<std::endl;
 
-        std::list<ref_ptr<CompileTraversal>> compileTraversals;
+        if (databasePager.compileThreadAffinity) setAffinity(databasePager.compileThreadAffinity);
 
-        int numCompileContexts = 16;
+        if (!db_ct)
+        {
+            // no CompileTraversal assigned so pass the subgraphs read straight through to be merged, used for CPU only paging such as a CameraPathReplay
+            while (status->active())
+            {
+                auto nodesToCompileOrDelete = compileQueue->take_share_when_available(databasePager.numCompileThreads, databasePager.maxNumCompilesPerBatch);
 
-        for (int i = 0; i < numCompileContexts; ++i)
+                DatabaseQueue::Nodes nodesToMerge;
+                for (auto& plod : nodesToCompileOrDelete)
+                {
+                    if (compare_exchange(plod->requestStatus, PagedLOD::DeleteRequest, PagedLOD::Deleting))
+                    {
+                        {
+                            std::scoped_lock<std::mutex> lock(databasePager.pendingPagedLODMutex);
+                            plod->pending = nullptr;
+                        }
+                        databasePager.requestDiscarded(plod);
+                    }
+                    else if (compare_exchange(plod->requestStatus, PagedLOD::CompileRequest, PagedLOD::Compiling))
+                    {
+                        if (plod->highResRequired(databasePager.frameCount))
+                        {
+                            {
+                                std::scoped_lock<std::mutex> lock(databasePager.pendingPagedLODMutex);
+                                plod->hostMemorySize = computeHostMemorySize(plod->pending);
+                            }
+                            plod->compileTime = clock::now();
+                            plod->requestStatus.exchange(PagedLOD::MergeRequest);
+                            nodesToMerge.emplace_back(plod);
+                            databasePager.compileCompleted(plod, nodesToMerge);
+                        }
+                        else
+                        {
+                            databasePager.readDiscarded(plod);
+                        }
+                    }
+                }
+
+                if (!nodesToMerge.empty()) toMergeQueue->add(nodesToMerge);
+            }
+            return;
+        }
+
+        // CommandPool and MemoryBufferPools are not thread safe so each compile thread needs its own
+        auto& db_context = db_ct->context;
+        ref_ptr<CommandPool> commandPool = db_context.commandPool;
+        if (db_context.graphicsQueue) commandPool = CommandPool::create(db_context.device, db_context.graphicsQueue->queueFamilyIndex());
+
+        auto deviceMemoryBufferPools = MemoryBufferPools::create("DatabasePager_Device_MemoryBufferPool", db_context.device, db_context.deviceMemoryBufferPools->bufferPreferences);
+        auto stagingMemoryBufferPools = MemoryBufferPools::create("DatabasePager_Staging_MemoryBufferPool", db_context.device, db_context.stagingMemoryBufferPools->bufferPreferences);
+
+        std::list<ref_ptr<CompileTraversal>> compileTraversals;
+
+        for (uint32_t i = 0; i < std::max(numCompileContexts, 1u); ++i)
         {
-            compileTraversals.emplace_back(new CompileTraversal(*db_ct));
+            ref_ptr<CompileTraversal> ct(new CompileTraversal(*db_ct));
+            ct->context.commandPool = commandPool;
+            ct->context.deviceMemoryBufferPools = deviceMemoryBufferPools;
+            ct->context.stagingMemoryBufferPools = stagingMemoryBufferPools;
+            ct->context.concurrentCompile = databasePager._concurrentCompile;
+            compileTraversals.emplace_back(ct);
         }
 
         // assign semaphores
@@ -245,11 +726,14 @@ void DatabasePager::start()
             ct->context.semaphore = Semaphore::create(ct->context.device, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT);
         }
 
+        // timeout in nanoseconds for checking whether the thread has been cancelled while waiting on semaphores
+        const uint64_t waitTimeout = 100000000;
+
         auto compile_itr = compileTraversals.begin();
 
         while (status->active())
         {
-            auto nodesToCompileOrDelete = compileQueue->take_all_when_available();
+            auto nodesToCompileOrDelete = compileQueue->take_share_when_available(databasePager.numCompileThreads, databasePager.maxNumCompilesPerBatch);
 
             DatabaseQueue::Nodes nodesToCompile;
             for (auto& plod : nodesToCompileOrDelete)
@@ -318,10 +802,10 @@ void DatabasePager::start()
                 //std::cout<<"Compile Semaphore after wait Semaphore "<<*(ct->context.semaphore->data())<<" , count "<<ct->context.semaphore->numDependentSubmissions().load()<<std::endl;
 #endif
 
-                while (ct->context.semaphore->numDependentSubmissions().load() > 0)
+                // wait for any frames that waited on the previous use of this CompileTraversal's semaphore to complete
+                while (!ct->context.semaphore->waitForDependentSubmissions(waitTimeout))
                 {
                     if (status->cancel()) return;
-                    std::this_thread::sleep_for(std::chrono::milliseconds(1));
                 }
 
 #if DO_TIMING
@@ -335,14 +819,15 @@ void DatabasePager::start()
 #endif
 
                 ct->context.semaphore->numDependentSubmissions().exchange(1);
+                ct->context.compileDependencies.clear();
 
                 DatabaseQueue::Nodes nodesCompiled;
+                DatabaseQueue::Nodes nodesCoalesced;
                 for (auto& plod : nodesToCompile)
                 {
                     if (compare_exchange(plod->requestStatus, PagedLOD::CompileRequest, PagedLOD::Compiling))
                     {
-                        uint64_t frameDelta = databasePager.frameCount - plod->frameHighResLastUsed.load();
-                        if (frameDelta <= 1)
+                        if (plod->highResRequired(databasePager.frameCount))
                         {
                             // std::cout<<"    compiling "<<plod->filename<<", "<<plod->requestCount.load()<<" Semaphore "<<*(ct->context.semaphore->data())<<", count "<<ct->context.semaphore->numDependentSubmissions().load()<<std::endl;
 
@@ -355,14 +840,31 @@ void DatabasePager::start()
                             // compiling subgraph
                             if (subgraph)
                             {
+                                // measure the memory held by this subgraph so the pager can expire against memory budgets, the staging memory used for the upload is returned to the pool so isn't counted
+                                auto previousDeviceMemoryReserved = ct->context.deviceMemoryBufferPools->cumulativeReservedSize;
+
+                                auto& pagerStats = *databasePager.stats;
+                                auto startCompileTime = clock::now();
+                                pagerStats.readToCompile.add(startCompileTime - plod->readTime);
+
                                 subgraph->accept(*ct);
+
+                                plod->hostMemorySize = computeHostMemorySize(subgraph);
+                                plod->deviceMemorySize = ct->context.deviceMemoryBufferPools->cumulativeReservedSize - previousDeviceMemoryReserved;
+
+                                plod->compileTime = clock::now();
+                                pagerStats.compile.add(plod->compileTime - startCompileTime);
+                                ++pagerStats.numCompiled;
+                                pagerStats.bytesCompiled += plod->hostMemorySize + plod->deviceMemorySize;
+
                                 nodesCompiled.emplace_back(plod);
+                                databasePager.compileCompleted(plod, nodesCoalesced);
                             }
                             else
                             {
                                 // need to reset the PLOD so that it's no longer part of the DatabasePager's queues and is ready to be compile when next requested.
                                 std::cout << "Expire compile request " << plod->filename << std::endl;
-                                databasePager.requestDiscarded(plod);
+                                databasePager.readDiscarded(plod);
                             }
                         }
                         else
@@ -377,7 +879,7 @@ void DatabasePager::start()
                             std::cout << "Expire compile request" << std::endl;
 #endif
                             // need to reset the PLOD so that it's no longer part of the DatabasePager's queues and is ready to be compile when next requested.
-                            databasePager.requestDiscarded(plod);
+                            databasePager.readDiscarded(plod);
                         }
                     }
                     else
@@ -399,34 +901,61 @@ void DatabasePager::start()
 #endif
                 if (!nodesCompiled.empty())
                 {
+                    // subgraphs that are already compiled don't add any commands, in which case nothing is submitted to signal the semaphore
+                    bool submitted = !ct->context.commands.empty() || !ct->context.buildAccelerationStructureCommands.empty();
+
                     ct->context.record();
 
                     for (auto& plod : nodesCompiled)
                     {
-                        plod->semaphore = ct->context.semaphore;
+                        if (submitted) plod->semaphore = ct->context.semaphore;
                         plod->requestStatus.exchange(PagedLOD::MergeRequest);
                     }
 
+                    // requests coalesced with the ones compiled share their subgraphs so are merged in the same batch
+                    for (auto& plod : nodesCoalesced)
+                    {
+                        if (submitted) plod->semaphore = ct->context.semaphore;
+                        nodesCompiled.emplace_back(plod);
+                    }
+
+                    if (!submitted) ct->context.semaphore->resetDependentSubmissions();
+
+                    if (!ct->context.compileDependencies.empty())
+                    {
+                        std::scoped_lock<std::mutex> lock(databasePager._mergeDependenciesMutex);
+                        for (auto& plod : nodesCompiled)
+                        {
+                            databasePager._mergeDependencies[plod.get()].insert(ct->context.compileDependencies.begin(), ct->context.compileDependencies.end());
+                        }
+                    }
+
                     toMergeQueue->add(nodesCompiled);
+
+                    // batches that depend on objects compiled in this batch can now be merged along with it
+                    if (ct->context.concurrentCompile) ct->context.concurrentCompile->submitted(ct->context.semaphore);
                 }
                 else
                 {
-                    ct->context.semaphore->numDependentSubmissions().exchange(0);
+                    ct->context.semaphore->resetDependentSubmissions();
                 }
             }
         }
         //std::cout<<"Finished DatabaseThread compile thread"<<std::endl;
     };
 
-    for (int i = 0; i < numCompileThreads; ++i)
+    if (numCompileThreads > 1 && compileTraversal) _concurrentCompile = ConcurrentCompile::create();
+
+    for (uint32_t i = 0; i < numCompileThreads; ++i)
     {
-        _compileThreads.emplace_back(compile, std::ref(_compileQueue), std::ref(_toMergeQueue), std::ref(compileTraversal), std::ref(_status), std::ref(*this));
+        _compileThreads.emplace_back(compile, std::ref(_compileQueue), std::ref(_toMergeQueue), std::ref(compileTraversal), numCompileTraversalsPerThread, std::ref(_status), std::ref(*this));
     }
 }
 
 void DatabasePager::request(ref_ptr<PagedLOD> plod)
 {
     ++numActiveRequests;
+    ++stats->numRequests;
 
     //std::cout<<"DatabasePager::request("<<plod.get()<<") "<<plod->filename<<", "<<plod->priority<<std::endl;
     bool hasPending = false;
@@ -440,6 +969,8 @@ void DatabasePager::request(ref_ptr<PagedLOD> plod)
         // std::cout<<"DatabasePager::request("<<plod.get()<<") has pending subgraphs to transfer to compile "<<plod->filename<<", "<<plod->priority<<" plod="<<plod.get()<<std::endl;
         if (compare_exchange(plod->requestStatus, PagedLOD::NoRequest, PagedLOD::CompileRequest))
         {
+            // previously read subgraph so the read stage is skipped
+            plod->requestTime = plod->readTime = clock::now();
             _compileQueue->add(plod);
         }
         else
@@ -451,8 +982,9 @@ void DatabasePager::request(ref_ptr<PagedLOD> plod)
     {
         if (compare_exchange(plod->requestStatus, PagedLOD::NoRequest, PagedLOD::ReadRequest))
         {
+            plod->requestTime = clock::now();
             // std::cout<<"DatabasePager::request("<<plod.get()<<") adding to requeQueue "<<plod->filename<<", "<<plod->priority<<" plod="<<plod.get()<<std::endl;
-            _requestQueue->add(plod);
+            if (coalesceRead(plod)) _requestQueue->add(plod);
         }
         else
         {
@@ -461,22 +993,214 @@ void DatabasePager::request(ref_ptr<PagedLOD> plod)
     }
 }
 
+void DatabasePager::updatePriority(const PagedLOD* plod)
+{
+    // only pending read requests are ordered by priority
+    if (plod->requestStatus.load() == PagedLOD::ReadRequest)
+    {
+        _requestQueue->updatePriority(plod);
+    }
+}
+
 void DatabasePager::requestDiscarded(PagedLOD* plod)
 {
     //std::scoped_lock<std::mutex> lock(pendingPagedLODMutex);
     //plod->pending = nullptr;
     plod->requestCount.exchange(0);
-    plod->requestStatus.exchange(PagedLOD::NoRequest);
+    if (plod->requestStatus.exchange(PagedLOD::NoRequest) != PagedLOD::Deleting) ++stats->numDiscarded;
     --numActiveRequests;
 }
 
+bool DatabasePager::coalesceRead(ref_ptr<PagedLOD> plod)
+{
+    std::scoped_lock<std::mutex> lock(_coalescedReadsMutex);
+
+    auto& coalescedRead = _coalescedReads[CoalescedReadKey(plod->filename, plod->options.get())];
+    if (coalescedRead.leader)
+    {
+        coalescedRead.followers.emplace_back(plod);
+        return false;
+    }
+
+    coalescedRead.leader = plod;
+    return true;
+}
+
+void DatabasePager::readCompleted(PagedLOD* plod, ref_ptr<Node> subgraph)
+{
+    // the followers wait for the leader's compile to complete before being merged, see compileCompleted()
+    if (subgraph) return;
+
+    DatabaseQueue::Nodes followers;
+    {
+        std::scoped_lock<std::mutex> lock(_coalescedReadsMutex);
+
+        auto itr = _coalescedReads.find(CoalescedReadKey(plod->filename, plod->options.get()));
+        if (itr == _coalescedReads.end() || itr->second.leader != plod) return;
+
+        followers.swap(itr->second.followers);
+        _coalescedReads.erase(itr);
+    }
+
+    for (auto& follower : followers)
+    {
+        requestDiscarded(follower);
+    }
+}
+
+void DatabasePager::compileCompleted(PagedLOD* plod, DatabaseQueue::Nodes& nodesToMerge)
+{
+    DatabaseQueue::Nodes followers;
+    {
+        std::scoped_lock<std::mutex> lock(_coalescedReadsMutex);
+
+        auto itr = _coalescedReads.find(CoalescedReadKey(plod->filename, plod->options.get()));
+        if (itr == _coalescedReads.end() || itr->second.leader != plod) return;
+
+        followers.swap(itr->second.followers);
+        _coalescedReads.erase(itr);
+    }
+
+    if (followers.empty()) return;
+
+    ref_ptr<Node> subgraph;
+    {
+        std::scoped_lock<std::mutex> lock(pendingPagedLODMutex);
+        subgraph = plod->pending;
+    }
+
+    for (auto& follower : followers)
+    {
+        if (subgraph && follower->highResRequired(frameCount) && compare_exchange(follower->requestStatus, PagedLOD::ReadRequest, PagedLOD::MergeRequest))
+        {
+            {
+                std::scoped_lock<std::mutex> lock(pendingPagedLODMutex);
+                follower->pending = subgraph;
+            }
+
+            // the memory is shared with the leader's subgraph, updateSceneGraph() counts the holders of each subgraph so it is only accounted for once
+            follower->hostMemorySize = plod->hostMemorySize;
+            follower->deviceMemorySize = plod->deviceMemorySize;
+            follower->readTime = plod->readTime;
+            follower->compileTime = plod->compileTime;
+            ++stats->numCoalescedReads;
+
+            nodesToMerge.emplace_back(follower);
+        }
+        else
+        {
+            requestDiscarded(follower);
+        }
+    }
+}
+
+void DatabasePager::readDiscarded(ref_ptr<PagedLOD> plod)
+{
+    ref_ptr<PagedLOD> newLeader;
+    DatabaseQueue::Nodes discarded;
+    {
+        std::scoped_lock<std::mutex> lock(_coalescedReadsMutex);
+
+        auto itr = _coalescedReads.find(CoalescedReadKey(plod->filename, plod->options.get()));
+        if (itr != _coalescedReads.end() && itr->second.leader == plod)
+        {
+            // promote the first follower still required to take over the read, discarding those that are no longer required
+            DatabaseQueue::Nodes remaining;
+            for (auto& follower : itr->second.followers)
+            {
+                if (!follower->highResRequired(frameCount))
+                {
+                    discarded.emplace_back(follower);
+                }
+                else if (!newLeader)
+                {
+                    newLeader = follower;
+                }
+                else
+                {
+                    remaining.emplace_back(follower);
+                }
+            }
+
+            if (newLeader)
+            {
+                itr->second.leader = newLeader;
+                itr->second.followers.swap(remaining);
+            }
+            else
+            {
+                _coalescedReads.erase(itr);
+            }
+        }
+    }
+
+    requestDiscarded(plod);
+
+    for (auto& follower : discarded)
+    {
+        requestDiscarded(follower);
+    }
+
+    if (newLeader) _requestQueue->add(newLeader);
+}
+
+bool DatabasePager::_takeMergeDependencies(DatabaseQueue::Nodes& nodes, const std::set<const Semaphore*>& deferred)
+{
+    if (!_concurrentCompile) return true;
+
+    std::set<const Semaphore*> visited;
+    for (auto& plod : nodes) visited.insert(plod->semaphore);
+
+    // nodes grows as the batches depended upon are appended, so their own dependencies are checked too
+    for (size_t i = 0; i < nodes.size(); ++i)
+    {
+        Semaphores dependencies;
+        {
+            std::scoped_lock<std::mutex> lock(_mergeDependenciesMutex);
+            if (auto itr = _mergeDependencies.find(nodes[i].get()); itr != _mergeDependencies.end()) dependencies = itr->second;
+        }
+
+        for (auto& semaphore : dependencies)
+        {
+            if (!visited.insert(semaphore).second) continue;
+
+            if (deferred.count(semaphore) != 0 || _concurrentCompile->pending(semaphore)) return false;
+
+            // a batch that isn't in the _toMergeQueue has already been merged, so an earlier frame has waited on its semaphore
+            for (auto& plod : _toMergeQueue->take_batch(semaphore))
+            {
+                nodes.emplace_back(plod);
+            }
+        }
+    }
+
+    std::scoped_lock<std::mutex> lock(_mergeDependenciesMutex);
+    for (auto& plod : nodes) _mergeDependencies.erase(plod.get());
+
+    return true;
+}
+
 void DatabasePager::updateSceneGraph(FrameStamp* frameStamp)
 {
     frameCount.exchange(frameStamp ? frameStamp->frameCount : 0);
 
     _semaphores.clear();
 
-    auto nodes = _toMergeQueue->take_all();
+    auto startTime = clock::now();
+
+    stats->update(startTime, static_cast<uint32_t>(_requestQueue->size()), static_cast<uint32_t>(_compileQueue->size()), static_cast<uint32_t>(_toMergeQueue->size()));
+
+    // cancel the read requests no longer required in bulk, rather than leaving them for the read threads to discard when they reach them
+    for (auto& plod : _requestQueue->take_stale(frameCount))
+    {
+        readDiscarded(plod);
+    }
+    auto timeBudgetExceeded = [&]() {
+        return maxUpdateSceneGraphTime > 0.0 && std::chrono::duration<double, std::chrono::milliseconds::period>(clock::now() - startTime).count() > maxUpdateSceneGraphTime;
+    };
+
+    // number of compiled subgraphs waiting to be merged, those not merged this frame due to budget limits remain in the _toMergeQueue in priority order.
+    uint32_t numPendingMerges = static_cast<uint32_t>(_toMergeQueue->size());
 
     if (culledPagedLODs)
     {
@@ -527,19 +1251,28 @@ void DatabasePager::updateSceneGraph(FrameStamp* frameStamp)
         }
 
         auto& activeList = pagedLODContainer->activeList;
+
+        // resume the sweep from where the previous frame's sweep stopped, restarting from the head if that element has since left the activeList
+        uint32_t sweepIndex = (_activeListSweepIndex != 0 && elements[_activeListSweepIndex].list == &activeList) ? _activeListSweepIndex : activeList.head;
         uint32_t switchedCount = 0;
-        for (uint32_t index = activeList.head; index != 0;)
+        for (uint32_t numChecked = 0; sweepIndex != 0; ++numChecked)
         {
-            auto& element = elements[index];
-            index = element.next;
+            if (maxNumActiveChecksPerFrame > 0 && numChecked >= maxNumActiveChecksPerFrame) break;
+
+            // only check the clock periodically as the per element work is small
+            if ((numChecked % 64) == 63 && timeBudgetExceeded()) break;
+
+            auto& element = elements[sweepIndex];
+            sweepIndex = element.next;
 
             if (!element.plod->highResActive(frameCount))
             {
-                //std::cout<<"   active to inactive "<<index<<std::endl;
+                //std::cout<<"   active to inactive "<<sweepIndex<<std::endl;
                 ++switchedCount;
                 pagedLODContainer->inactive(element.plod.get());
             }
         }
+        _activeListSweepIndex = sweepIndex;
 
 #    if REPORT_STATS
         if (switchedCount > 0)
@@ -574,16 +1307,26 @@ void DatabasePager::updateSceneGraph(FrameStamp* frameStamp)
 
         culledPagedLODs->clear();
 
+        auto overMemoryBudget = [&]() {
+            return (targetMaxHostMemory > 0 && hostMemoryInUse.load() > targetMaxHostMemory) || (targetMaxDeviceMemory > 0 && deviceMemoryInUse.load() > targetMaxDeviceMemory);
+        };
+
         // set the number of PagedLOD to expire
         uint32_t total = pagedLODContainer->activeList.count + pagedLODContainer->inactiveList.count;
-        if ((nodes.size() + total) > targetMaxNumPagedLODWithHighResSubgraphs)
+        bool overCountBudget = (numPendingMerges + total) > targetMaxNumPagedLODWithHighResSubgraphs;
+        if (overCountBudget || overMemoryBudget())
         {
-            uint32_t numPagedLODHighRestSubgraphsToRemove = (static_cast<uint32_t>(nodes.size()) + total) - targetMaxNumPagedLODWithHighResSubgraphs;
-            uint32_t targetNumInactive = (numPagedLODHighRestSubgraphsToRemove < pagedLODContainer->inactiveList.count) ? (pagedLODContainer->inactiveList.count - numPagedLODHighRestSubgraphsToRemove) : 0;
+            uint32_t targetNumInactive = pagedLODContainer->inactiveList.count;
+            if (overCountBudget)
+            {
+                uint32_t numPagedLODHighRestSubgraphsToRemove = (numPendingMerges + total) - targetMaxNumPagedLODWithHighResSubgraphs;
+                targetNumInactive = (numPagedLODHighRestSubgraphsToRemove < pagedLODContainer->inactiveList.count) ? (pagedLODContainer->inactiveList.count - numPagedLODHighRestSubgraphsToRemove) : 0;
+            }
 
             // std::cout<<"Need to remove, inactive count = "<<pagedLODContainer->inactiveList.count <<", target = "<< targetNumInactive<<std::endl;
 
-            for (uint32_t index = pagedLODContainer->inactiveList.head; (index != 0) && (pagedLODContainer->inactiveList.count > targetNumInactive);)
+            // inactiveList is ordered from least recently used at the head to most recently used at the tail
+            for (uint32_t index = pagedLODContainer->inactiveList.head; (index != 0) && ((pagedLODContainer->inactiveList.count > targetNumInactive) || overMemoryBudget());)
             {
                 auto& element = elements[index];
                 index = element.next;
@@ -592,8 +1335,21 @@ void DatabasePager::updateSceneGraph(FrameStamp* frameStamp)
                 {
                     // std::cout<<"    trimming "<<plod<<std::endl;
                     ref_ptr<PagedLOD> plod = element.plod;
+                    if (auto& subgraph = plod->getChild(0).node)
+                    {
+                        // only release the memory once the last PagedLOD sharing the subgraph has expired
+                        auto holder_itr = _subgraphHolders.find(subgraph.get());
+                        if (holder_itr == _subgraphHolders.end() || --(holder_itr->second) == 0)
+                        {
+                            if (holder_itr != _subgraphHolders.end()) _subgraphHolders.erase(holder_itr);
+                            hostMemoryInUse -= plod->hostMemorySize;
+                            deviceMemoryInUse -= plod->deviceMemorySize;
+                        }
+                    }
                     plod->getChild(0).node = nullptr;
                     pagedLODContainer->remove(plod);
+                    ++stats->numExpired;
+                    ++sceneGraphModifiedCount;
                     _compileQueue->add_then_reset(plod);
                 }
             }
@@ -620,7 +1376,7 @@ void DatabasePager::updateSceneGraph(FrameStamp* frameStamp)
 #endif
     }
 
-    if (!nodes.empty())
+    if (numPendingMerges > 0)
     {
 
 #define LOCAL_MUTEX 1
@@ -629,9 +1385,12 @@ void DatabasePager::updateSceneGraph(FrameStamp* frameStamp)
         std::scoped_lock<std::mutex> lock(pendingPagedLODMutex);
 #endif
 
-        //std::cout<<"DatabasePager::updateSceneGraph() nodes to merge : nodes.size() = "<<nodes.size()<<", "<<numActiveRequests.load()<<std::endl;
-        for (auto& plod : nodes)
-        {
+        //std::cout<<"DatabasePager::updateSceneGraph() nodes to merge : numPendingMerges = "<<numPendingMerges<<", "<<numActiveRequests.load()<<std::endl;
+
+        uint32_t numMerged = 0;
+        auto merge = [&](ref_ptr<PagedLOD>& plod) {
+            ++numMerged;
+
             if (compare_exchange(plod->requestStatus, PagedLOD::MergeRequest, PagedLOD::Merging))
             {
 #if DO_TIMING
@@ -654,17 +1413,78 @@ void DatabasePager::updateSceneGraph(FrameStamp* frameStamp)
                     plod->getChild(0).node = plod->pending;
                 }
 
-                // insert any semaphore into a set that will be used by the GraphicsStage
-                if (plod->semaphore)
+                if (plod->getChild(0).node)
                 {
-                    _semaphores.insert(plod->semaphore);
-                    plod->semaphore = nullptr;
+                    auto mergeTime = clock::now();
+                    stats->compileToMerge.add(mergeTime - plod->compileTime);
+                    stats->requestToMerge.add(mergeTime - plod->requestTime);
+                    ++stats->numMerged;
+                    ++sceneGraphModifiedCount;
+
+                    // coalesced reads share a subgraph, so only the first PagedLOD merged with it adds its memory
+                    if (++_subgraphHolders[plod->getChild(0).node.get()] == 1)
+                    {
+                        hostMemoryInUse += plod->hostMemorySize;
+                        deviceMemoryInUse += plod->deviceMemorySize;
+                    }
+
+                    // prefetched subgraphs that haven't yet been used are placed in the inactiveList so they are expired like any other unused high res subgraph
+                    if (plod->index == 0) pagedLODContainer->inactive(plod.get());
                 }
 
                 plod->requestStatus.exchange(PagedLOD::NoRequest);
             }
+
+            // insert any semaphore into a set that will be used by the GraphicsStage, the set ensures each batch's semaphore is waited on just once
+            if (plod->semaphore)
+            {
+                _semaphores.insert(plod->semaphore);
+                plod->semaphore = nullptr;
+            }
+        };
+
+        // batches that can't be merged till other batches' transfers have been submitted, returned to the _toMergeQueue for a later frame
+        DatabaseQueue::Nodes deferred;
+        std::set<const Semaphore*> deferredSemaphores;
+
+        // merge the highest priority subgraphs first, always merging at least one so that paging progresses even when the budget is exhausted
+        while (numMerged == 0 || ((maxNumMergesPerFrame == 0 || numMerged < maxNumMergesPerFrame) && !timeBudgetExceeded()))
+        {
+            auto plod = _toMergeQueue->take();
+            if (!plod) break;
+
+            // all the subgraphs compiled in one batch share the batch's semaphore, which is signalled once so the whole batch has to be merged in the same frame
+            DatabaseQueue::Nodes batch{plod};
+            for (auto& batch_plod : _toMergeQueue->take_batch(plod->semaphore))
+            {
+                batch.emplace_back(batch_plod);
+            }
+
+            if (!_takeMergeDependencies(batch, deferredSemaphores))
+            {
+                for (auto& batch_plod : batch)
+                {
+                    deferredSemaphores.insert(batch_plod->semaphore);
+                    deferred.emplace_back(batch_plod);
+                }
+                continue;
+            }
+
+            for (auto& batch_plod : batch)
+            {
+                merge(batch_plod);
+            }
         }
-        numActiveRequests -= static_cast<uint32_t>(nodes.size());
+        numActiveRequests -= numMerged;
+
+        if (!deferred.empty()) _toMergeQueue->add(deferred);
+
+#if REPORT_STATS
+        if (numMerged < numPendingMerges)
+        {
+            std::cout << "merged " << numMerged << ", deferred " << (numPendingMerges - numMerged) << " to next frame" << std::endl;
+        }
+#endif
     }
     else
     {
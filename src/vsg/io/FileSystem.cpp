@@ -17,6 +17,7 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #    include <cstdlib>
 #    include <direct.h>
 #    include <io.h>
+#    include <sys/stat.h>
 #else
 #    include <sys/stat.h>
 #    include <unistd.h>
@@ -83,6 +84,18 @@ bool vsg::fileExists(const Path& path)
 #endif
 }
 
+uint64_t vsg::fileSize(const Path& path)
+{
+#if defined(WIN32) && !defined(__CYGWIN__)
+    struct _stat64 fileStats;
+    if (_stat64(path.c_str(), &fileStats) != 0) return 0;
+#else
+    struct stat fileStats;
+    if (stat(path.c_str(), &fileStats) != 0) return 0;
+#endif
+    return static_cast<uint64_t>(fileStats.st_size);
+}
+
 Path vsg::filePath(const Path& path)
 {
     std::string::size_type slash = path.find_last_of(PATH_SEPARATORS);
@@ -14,8 +14,10 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 
 using namespace vsg;
 
-#define VSG_REGISTER_new(ClassName) _createMap[#ClassName] = []() { return ref_ptr<Object>(new ClassName()); }
-#define VSG_REGISTER_create(ClassName) _createMap[#ClassName] = []() { return ClassName::create(); }
+#define VSG_REGISTER_new(ClassName) \
+    add(#ClassName, []() { return ref_ptr<Object>(new ClassName()); }, [](Allocator* allocator) { return createWithAllocator<ClassName>(allocator); })
+#define VSG_REGISTER_create(ClassName) \
+    add(#ClassName, []() { return ClassName::create(); }, [](Allocator* allocator) { return createWithAllocator<ClassName>(allocator); })
 
 ref_ptr<ObjectFactory>& ObjectFactory::instance()
 {
@@ -26,7 +28,7 @@ ref_ptr<ObjectFactory>& ObjectFactory::instance()
 
 ObjectFactory::ObjectFactory()
 {
-    _createMap["nullptr"] = []() { return ref_ptr<Object>(); };
+    add("nullptr", []() { return ref_ptr<Object>(); });
 
     VSG_REGISTER_new(vsg::Object);
     VSG_REGISTER_new(vsg::Objects);
@@ -133,6 +135,7 @@ ObjectFactory::ObjectFactory()
     VSG_REGISTER_create(vsg::QuadGroup);
     VSG_REGISTER_create(vsg::StateGroup);
     VSG_REGISTER_create(vsg::CullGroup);
+    VSG_REGISTER_create(vsg::BVHGroup);
     VSG_REGISTER_create(vsg::CullNode);
     VSG_REGISTER_create(vsg::LOD);
     VSG_REGISTER_create(vsg::PagedLOD);
@@ -178,6 +181,7 @@ ObjectFactory::ObjectFactory()
 
     // application
     VSG_REGISTER_create(vsg::EllipsoidModel);
+    VSG_REGISTER_create(vsg::CameraPath);
 }
 
 vsg::ref_ptr<vsg::Object> ObjectFactory::create(const std::string& className)
@@ -191,3 +195,79 @@ vsg::ref_ptr<vsg::Object> ObjectFactory::create(const std::string& className)
     //std::cout << "Warning: ObjectFactory::create(" << className << ") failed to find means to create object" << std::endl;
     return vsg::ref_ptr<vsg::Object>();
 }
+
+vsg::ref_ptr<vsg::Object> ObjectFactory::create(const std::string& className, Allocator* allocator)
+{
+    if (allocator)
+    {
+        if (auto itr = _createWithAllocatorMap.find(className); itr != _createWithAllocatorMap.end())
+        {
+            return (itr->second)(allocator);
+        }
+    }
+
+    return create(className);
+}
+
+vsg::ref_ptr<vsg::Object> ObjectFactory::create(const InternedString& className, Allocator* allocator)
+{
+    // subclasses may override the virtual create(..) methods, so only use the interned lookup when they can't have been
+    if (typeid(*this) == typeid(ObjectFactory))
+    {
+        if (auto functions = _findTypeFunctions(className))
+        {
+            if (allocator && functions->createWithAllocator) return functions->createWithAllocator(allocator);
+            if (functions->create) return functions->create();
+        }
+    }
+
+    return create(className.str(), allocator);
+}
+
+const ObjectFactory::TypeFunctions* ObjectFactory::_findTypeFunctions(const InternedString& className)
+{
+    if (_typeFunctionsDirty) _updateTypeFunctions();
+
+    if (className.id() >= _typeFunctions.size() || !_typeFunctions[className.id()].create)
+    {
+        // classes may have been added through a map reference returned before _typeFunctions was built
+        if (_createMap.size() == _typeFunctionsCreateMapSize && _createWithAllocatorMap.size() == _typeFunctionsCreateWithAllocatorMapSize) return nullptr;
+
+        _typeFunctionsDirty = true;
+        _updateTypeFunctions();
+        if (className.id() >= _typeFunctions.size()) return nullptr;
+    }
+
+    return &_typeFunctions[className.id()];
+}
+
+void ObjectFactory::add(const std::string& className, CreateFunction createFunction, CreateWithAllocatorFunction createWithAllocatorFunction)
+{
+    _createMap[className] = createFunction;
+    if (createWithAllocatorFunction) _createWithAllocatorMap[className] = createWithAllocatorFunction;
+
+    _typeFunctionsDirty = true;
+}
+
+void ObjectFactory::_updateTypeFunctions()
+{
+    std::scoped_lock<std::mutex> lock(_typeFunctionsMutex);
+
+    // another thread may have rebuilt _typeFunctions while this one waited for the lock
+    if (!_typeFunctionsDirty) return;
+
+    _typeFunctions.clear();
+
+    auto functionsFor = [&](const std::string& className) -> TypeFunctions& {
+        InternedString key(className);
+        if (key.id() >= _typeFunctions.size()) _typeFunctions.resize(key.id() + 1);
+        return _typeFunctions[key.id()];
+    };
+
+    for (auto& [className, createFunction] : _createMap) functionsFor(className).create = createFunction;
+    for (auto& [className, createWithAllocatorFunction] : _createWithAllocatorMap) functionsFor(className).createWithAllocator = createWithAllocatorFunction;
+
+    _typeFunctionsCreateMapSize = _createMap.size();
+    _typeFunctionsCreateWithAllocatorMapSize = _createWithAllocatorMap.size();
+    _typeFunctionsDirty = false;
+}
@@ -0,0 +1,140 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2020 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/maths/plane.h>
+
+// SIMD code paths are selected at compile time from the instruction sets the compiler targets, i.e. -mavx or -march=native enables the AVX path.
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#    define VSG_USE_SSE2 1
+#    include <emmintrin.h>
+#endif
+
+#if defined(__AVX__)
+#    define VSG_USE_AVX 1
+#    include <immintrin.h>
+#endif
+
+using namespace vsg;
+
+template<typename T>
+std::size_t t_intersect(const t_plane<T>* planes, std::size_t numPlanes, const t_sphere<T>* spheres, std::size_t numSpheres, uint8_t* visible)
+{
+    std::size_t numVisible = 0;
+    for (std::size_t i = 0; i < numSpheres; ++i)
+    {
+        visible[i] = intersect(planes, planes + numPlanes, spheres[i]) ? 1 : 0;
+        numVisible += visible[i];
+    }
+    return numVisible;
+}
+
+std::size_t vsg::intersect(const plane* planes, std::size_t numPlanes, const sphere* spheres, std::size_t numSpheres, uint8_t* visible)
+{
+    std::size_t i = 0;
+    std::size_t numVisible = 0;
+
+#if defined(VSG_USE_SSE2)
+    // transpose 4 spheres into x, y, z and r vectors and test them against each plane in turn, stopping once all 4 are outside a plane
+    for (; i + 4 <= numSpheres; i += 4)
+    {
+        __m128 x = _mm_loadu_ps(spheres[i].value);
+        __m128 y = _mm_loadu_ps(spheres[i + 1].value);
+        __m128 z = _mm_loadu_ps(spheres[i + 2].value);
+        __m128 negative_r = _mm_loadu_ps(spheres[i + 3].value);
+        _MM_TRANSPOSE4_PS(x, y, z, negative_r);
+        negative_r = _mm_sub_ps(_mm_setzero_ps(), negative_r);
+
+        int outside = 0;
+        for (std::size_t p = 0; p < numPlanes && outside != 0xf; ++p)
+        {
+            const float* pl = planes[p].value;
+            __m128 d = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(pl[0]), x), _mm_mul_ps(_mm_set1_ps(pl[1]), y));
+            d = _mm_add_ps(_mm_add_ps(d, _mm_mul_ps(_mm_set1_ps(pl[2]), z)), _mm_set1_ps(pl[3]));
+            outside |= _mm_movemask_ps(_mm_cmplt_ps(d, negative_r));
+        }
+
+        for (int j = 0; j < 4; ++j)
+        {
+            visible[i + j] = (outside & (1 << j)) ? 0 : 1;
+            numVisible += visible[i + j];
+        }
+    }
+#endif
+
+    return numVisible + t_intersect(planes, numPlanes, spheres + i, numSpheres - i, visible + i);
+}
+
+std::size_t vsg::intersect(const dplane* planes, std::size_t numPlanes, const dsphere* spheres, std::size_t numSpheres, uint8_t* visible)
+{
+    std::size_t i = 0;
+    std::size_t numVisible = 0;
+
+#if defined(VSG_USE_AVX)
+    // transpose 4 spheres into x, y, z and r vectors and test them against each plane in turn, stopping once all 4 are outside a plane
+    for (; i + 4 <= numSpheres; i += 4)
+    {
+        const __m256d s0 = _mm256_loadu_pd(spheres[i].value);
+        const __m256d s1 = _mm256_loadu_pd(spheres[i + 1].value);
+        const __m256d s2 = _mm256_loadu_pd(spheres[i + 2].value);
+        const __m256d s3 = _mm256_loadu_pd(spheres[i + 3].value);
+        const __m256d t0 = _mm256_unpacklo_pd(s0, s1);
+        const __m256d t1 = _mm256_unpackhi_pd(s0, s1);
+        const __m256d t2 = _mm256_unpacklo_pd(s2, s3);
+        const __m256d t3 = _mm256_unpackhi_pd(s2, s3);
+        const __m256d x = _mm256_permute2f128_pd(t0, t2, 0x20);
+        const __m256d y = _mm256_permute2f128_pd(t1, t3, 0x20);
+        const __m256d z = _mm256_permute2f128_pd(t0, t2, 0x31);
+        const __m256d negative_r = _mm256_sub_pd(_mm256_setzero_pd(), _mm256_permute2f128_pd(t1, t3, 0x31));
+
+        int outside = 0;
+        for (std::size_t p = 0; p < numPlanes && outside != 0xf; ++p)
+        {
+            const double* pl = planes[p].value;
+            __m256d d = _mm256_add_pd(_mm256_mul_pd(_mm256_broadcast_sd(&pl[0]), x), _mm256_mul_pd(_mm256_broadcast_sd(&pl[1]), y));
+            d = _mm256_add_pd(_mm256_add_pd(d, _mm256_mul_pd(_mm256_broadcast_sd(&pl[2]), z)), _mm256_broadcast_sd(&pl[3]));
+            outside |= _mm256_movemask_pd(_mm256_cmp_pd(d, negative_r, _CMP_LT_OQ));
+        }
+
+        for (int j = 0; j < 4; ++j)
+        {
+            visible[i + j] = (outside & (1 << j)) ? 0 : 1;
+            numVisible += visible[i + j];
+        }
+    }
+#elif defined(VSG_USE_SSE2)
+    // transpose 2 spheres into x, y, z and r vectors and test them against each plane in turn, stopping once both are outside a plane
+    for (; i + 2 <= numSpheres; i += 2)
+    {
+        const __m128d s0_xy = _mm_loadu_pd(spheres[i].value), s0_zr = _mm_loadu_pd(spheres[i].value + 2);
+        const __m128d s1_xy = _mm_loadu_pd(spheres[i + 1].value), s1_zr = _mm_loadu_pd(spheres[i + 1].value + 2);
+        const __m128d x = _mm_unpacklo_pd(s0_xy, s1_xy);
+        const __m128d y = _mm_unpackhi_pd(s0_xy, s1_xy);
+        const __m128d z = _mm_unpacklo_pd(s0_zr, s1_zr);
+        const __m128d negative_r = _mm_sub_pd(_mm_setzero_pd(), _mm_unpackhi_pd(s0_zr, s1_zr));
+
+        int outside = 0;
+        for (std::size_t p = 0; p < numPlanes && outside != 0x3; ++p)
+        {
+            const double* pl = planes[p].value;
+            __m128d d = _mm_add_pd(_mm_mul_pd(_mm_set1_pd(pl[0]), x), _mm_mul_pd(_mm_set1_pd(pl[1]), y));
+            d = _mm_add_pd(_mm_add_pd(d, _mm_mul_pd(_mm_set1_pd(pl[2]), z)), _mm_set1_pd(pl[3]));
+            outside |= _mm_movemask_pd(_mm_cmplt_pd(d, negative_r));
+        }
+
+        visible[i] = (outside & 1) ? 0 : 1;
+        visible[i + 1] = (outside & 2) ? 0 : 1;
+        numVisible += visible[i] + visible[i + 1];
+    }
+#endif
+
+    return numVisible + t_intersect(planes, numPlanes, spheres + i, numSpheres - i, visible + i);
+}
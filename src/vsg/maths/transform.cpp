@@ -12,8 +12,118 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 
 #include <vsg/maths/transform.h>
 
+// SIMD code paths are selected at compile time from the instruction sets the compiler targets, i.e. -mavx2 or -march=native enables the AVX/AVX2 paths.
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#    define VSG_USE_SSE2 1
+#    include <emmintrin.h>
+#endif
+
+#if defined(__AVX__)
+#    define VSG_USE_AVX 1
+#    include <immintrin.h>
+#endif
+
+#if defined(__AVX2__)
+#    define VSG_USE_AVX2 1
+#endif
+
 using namespace vsg;
 
+///////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// transform of vertex arrays
+//
+void vsg::transform(const mat4& matrix, const vec3* in, vec3* out, std::size_t count)
+{
+#if defined(VSG_USE_SSE2)
+    const __m128 c0 = _mm_loadu_ps(matrix.value[0].value);
+    const __m128 c1 = _mm_loadu_ps(matrix.value[1].value);
+    const __m128 c2 = _mm_loadu_ps(matrix.value[2].value);
+    const __m128 c3 = _mm_loadu_ps(matrix.value[3].value);
+    const __m128 one = _mm_set1_ps(1.0f);
+
+    alignas(16) float result[4];
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const vec3& v = in[i];
+        __m128 p = _mm_add_ps(_mm_mul_ps(c0, _mm_set1_ps(v.x)), _mm_mul_ps(c1, _mm_set1_ps(v.y)));
+        p = _mm_add_ps(_mm_add_ps(p, _mm_mul_ps(c2, _mm_set1_ps(v.z))), c3);
+        const __m128 inv = _mm_div_ps(one, _mm_shuffle_ps(p, p, _MM_SHUFFLE(3, 3, 3, 3)));
+        _mm_store_ps(result, _mm_mul_ps(p, inv));
+        out[i].set(result[0], result[1], result[2]);
+    }
+#else
+    for (std::size_t i = 0; i < count; ++i) out[i] = matrix * in[i];
+#endif
+}
+
+void vsg::transform(const dmat4& matrix, const dvec3* in, dvec3* out, std::size_t count)
+{
+#if defined(VSG_USE_AVX)
+    const __m256d c0 = _mm256_loadu_pd(matrix.value[0].value);
+    const __m256d c1 = _mm256_loadu_pd(matrix.value[1].value);
+    const __m256d c2 = _mm256_loadu_pd(matrix.value[2].value);
+    const __m256d c3 = _mm256_loadu_pd(matrix.value[3].value);
+    const __m256d one = _mm256_set1_pd(1.0);
+
+    alignas(32) double result[4];
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const dvec3& v = in[i];
+        __m256d p = _mm256_add_pd(_mm256_mul_pd(c0, _mm256_set1_pd(v.x)), _mm256_mul_pd(c1, _mm256_set1_pd(v.y)));
+        p = _mm256_add_pd(_mm256_add_pd(p, _mm256_mul_pd(c2, _mm256_set1_pd(v.z))), c3);
+        const __m256d w = _mm256_permute_pd(_mm256_permute2f128_pd(p, p, 0x11), 0xf);
+        _mm256_store_pd(result, _mm256_mul_pd(p, _mm256_div_pd(one, w)));
+        out[i].set(result[0], result[1], result[2]);
+    }
+#elif defined(VSG_USE_SSE2)
+    const __m128d c0_xy = _mm_loadu_pd(matrix.value[0].value), c0_zw = _mm_loadu_pd(matrix.value[0].value + 2);
+    const __m128d c1_xy = _mm_loadu_pd(matrix.value[1].value), c1_zw = _mm_loadu_pd(matrix.value[1].value + 2);
+    const __m128d c2_xy = _mm_loadu_pd(matrix.value[2].value), c2_zw = _mm_loadu_pd(matrix.value[2].value + 2);
+    const __m128d c3_xy = _mm_loadu_pd(matrix.value[3].value), c3_zw = _mm_loadu_pd(matrix.value[3].value + 2);
+    const __m128d one = _mm_set1_pd(1.0);
+
+    alignas(16) double result[4];
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const dvec3& v = in[i];
+        const __m128d x = _mm_set1_pd(v.x), y = _mm_set1_pd(v.y), z = _mm_set1_pd(v.z);
+        const __m128d p_xy = _mm_add_pd(_mm_add_pd(_mm_add_pd(_mm_mul_pd(c0_xy, x), _mm_mul_pd(c1_xy, y)), _mm_mul_pd(c2_xy, z)), c3_xy);
+        const __m128d p_zw = _mm_add_pd(_mm_add_pd(_mm_add_pd(_mm_mul_pd(c0_zw, x), _mm_mul_pd(c1_zw, y)), _mm_mul_pd(c2_zw, z)), c3_zw);
+        const __m128d inv = _mm_div_pd(one, _mm_unpackhi_pd(p_zw, p_zw));
+        _mm_store_pd(result, _mm_mul_pd(p_xy, inv));
+        _mm_store_pd(result + 2, _mm_mul_pd(p_zw, inv));
+        out[i].set(result[0], result[1], result[2]);
+    }
+#else
+    for (std::size_t i = 0; i < count; ++i) out[i] = matrix * in[i];
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// split
+//
+// round to float precision in double arithmetic so the low part, in - high, is computed exactly rather than relying on a float round trip being kept
+static inline double float_precision(double v)
+{
+    int exponent;
+    double mantissa = std::frexp(v, &exponent);
+    return std::ldexp(std::nearbyint(std::ldexp(mantissa, 24)), exponent - 24);
+}
+
+void vsg::split(const dvec3& in, vec3& high, vec3& low)
+{
+    dvec3 h(float_precision(in.x), float_precision(in.y), float_precision(in.z));
+    high.set(static_cast<float>(h.x), static_cast<float>(h.y), static_cast<float>(h.z));
+    low.set(static_cast<float>(in.x - h.x), static_cast<float>(in.y - h.y), static_cast<float>(in.z - h.z));
+}
+
+void vsg::split(const dvec3* in, vec3* high, vec3* low, std::size_t count)
+{
+    for (std::size_t i = 0; i < count; ++i) split(in[i], high[i], low[i]);
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 //
 // inverse
@@ -118,6 +228,59 @@ T t_inverse_4x4(const T& m)
         inv_det * (m[0][0] * A1212 - m[0][1] * A0212 + m[0][2] * A0112)); // 33
 }
 
+#if defined(VSG_USE_AVX2)
+static inline __m256d avx_cross(__m256d a, __m256d b)
+{
+    const __m256d a_yzx = _mm256_permute4x64_pd(a, _MM_SHUFFLE(3, 0, 2, 1));
+    const __m256d b_yzx = _mm256_permute4x64_pd(b, _MM_SHUFFLE(3, 0, 2, 1));
+    const __m256d c = _mm256_sub_pd(_mm256_mul_pd(a, b_yzx), _mm256_mul_pd(a_yzx, b));
+    return _mm256_permute4x64_pd(c, _MM_SHUFFLE(3, 0, 2, 1));
+}
+
+static dmat4 avx_inverse_4x3(const dmat4& m)
+{
+    // the 3x3 rotation/scale part is loaded with the w components zeroed so the w lanes remain zero throughout
+    const __m256d zero = _mm256_setzero_pd();
+    const __m256d c0 = _mm256_blend_pd(_mm256_loadu_pd(m.value[0].value), zero, 0x8);
+    const __m256d c1 = _mm256_blend_pd(_mm256_loadu_pd(m.value[1].value), zero, 0x8);
+    const __m256d c2 = _mm256_blend_pd(_mm256_loadu_pd(m.value[2].value), zero, 0x8);
+
+    // rows of the inverse 3x3 matrix are the cross products of the columns divided by the determinant
+    const __m256d r0 = avx_cross(c1, c2);
+    const __m256d r1 = avx_cross(c2, c0);
+    const __m256d r2 = avx_cross(c0, c1);
+
+    __m256d det = _mm256_mul_pd(c0, r0);
+    det = _mm256_add_pd(det, _mm256_permute_pd(det, 0x5));
+    det = _mm256_add_pd(det, _mm256_permute2f128_pd(det, det, 0x01));
+
+    if (_mm256_cvtsd_f64(det) == 0.0) return dmat4(std::numeric_limits<double>::quiet_NaN()); // could use signaling_NaN()
+
+    // transpose the rows into columns, the fourth row being zero
+    const __m256d t0 = _mm256_unpacklo_pd(r0, r1);
+    const __m256d t1 = _mm256_unpackhi_pd(r0, r1);
+    const __m256d t2 = _mm256_unpacklo_pd(r2, zero);
+    const __m256d t3 = _mm256_unpackhi_pd(r2, zero);
+
+    const __m256d inv_det = _mm256_div_pd(_mm256_set1_pd(1.0), det);
+    const __m256d i0 = _mm256_mul_pd(_mm256_permute2f128_pd(t0, t2, 0x20), inv_det);
+    const __m256d i1 = _mm256_mul_pd(_mm256_permute2f128_pd(t1, t3, 0x20), inv_det);
+    const __m256d i2 = _mm256_mul_pd(_mm256_permute2f128_pd(t0, t2, 0x31), inv_det);
+
+    // translation is the negated inverse 3x3 matrix multiplied by the original translation, with w set to 1
+    const double* t = m.value[3].value;
+    __m256d translation = _mm256_add_pd(_mm256_add_pd(_mm256_mul_pd(i0, _mm256_set1_pd(t[0])), _mm256_mul_pd(i1, _mm256_set1_pd(t[1]))), _mm256_mul_pd(i2, _mm256_set1_pd(t[2])));
+    translation = _mm256_sub_pd(_mm256_set_pd(1.0, 0.0, 0.0, 0.0), translation);
+
+    dmat4 result;
+    _mm256_storeu_pd(result.value[0].value, i0);
+    _mm256_storeu_pd(result.value[1].value, i1);
+    _mm256_storeu_pd(result.value[2].value, i2);
+    _mm256_storeu_pd(result.value[3].value, translation);
+    return result;
+}
+#endif
+
 mat4 vsg::inverse_4x3(const mat4& m)
 {
     return t_inverse_4x3(m);
@@ -142,7 +305,11 @@ mat4 vsg::inverse(const mat4& m)
 
 dmat4 vsg::inverse_4x3(const dmat4& m)
 {
+#if defined(VSG_USE_AVX2)
+    return avx_inverse_4x3(m);
+#else
     return t_inverse_4x3(m);
+#endif
 }
 
 dmat4 vsg::inverse_4x4(const dmat4& m)
@@ -154,7 +321,7 @@ dmat4 vsg::inverse(const dmat4& m)
 {
     if (m[0][3] == 0.0 && m[1][3] == 0.0 && m[2][3] == 0.0 && m[3][3] == 1.0)
     {
-        return t_inverse_4x3(m);
+        return inverse_4x3(m);
     }
     else
     {
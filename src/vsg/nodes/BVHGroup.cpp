@@ -0,0 +1,201 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2020 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/io/stream.h>
+#include <vsg/nodes/BVHGroup.h>
+#include <vsg/nodes/CullGroup.h>
+#include <vsg/nodes/CullNode.h>
+#include <vsg/nodes/LOD.h>
+#include <vsg/nodes/PagedLOD.h>
+#include <vsg/traversals/ComputeBounds.h>
+
+#include <algorithm>
+#include <iostream>
+
+using namespace vsg;
+
+struct BoundedChild
+{
+    dsphere bound;
+    ref_ptr<Node> node;
+};
+
+using BoundedChildren = std::vector<BoundedChild>;
+
+static dsphere computeBound(const Node* node)
+{
+    if (auto cullNode = node->cast<CullNode>()) return cullNode->getBound();
+    if (auto cullGroup = node->cast<CullGroup>()) return cullGroup->getBound();
+    if (auto lod = node->cast<LOD>()) return lod->getBound();
+    if (auto plod = node->cast<PagedLOD>()) return plod->getBound();
+    if (auto bvhGroup = node->cast<BVHGroup>(); bvhGroup && bvhGroup->getNumBoundedChildren() == bvhGroup->getChildren().size()) return bvhGroup->getBound();
+
+    auto computeBounds = ComputeBounds::create();
+    node->accept(*computeBounds);
+
+    const auto& bb = computeBounds->bounds;
+    if (!bb.valid()) return dsphere();
+
+    return dsphere((bb.min + bb.max) * 0.5, length(bb.max - bb.min) * 0.5);
+}
+
+static uint32_t buildCell(BVHGroup::Cells& cells, BoundedChildren& children, uint32_t begin, uint32_t end, uint32_t maximumChildrenPerCell)
+{
+    // bound the extents of the children's spheres and of their centers, the latter used to choose the split axis
+    dbox extents, centers;
+    for (uint32_t i = begin; i < end; ++i)
+    {
+        const auto& bound = children[i].bound;
+        extents.add(bound.center - dvec3(bound.radius, bound.radius, bound.radius));
+        extents.add(bound.center + dvec3(bound.radius, bound.radius, bound.radius));
+        centers.add(bound.center);
+    }
+
+    dvec3 center = (extents.min + extents.max) * 0.5;
+    double radius = 0.0;
+    for (uint32_t i = begin; i < end; ++i)
+    {
+        const auto& bound = children[i].bound;
+        radius = std::max(radius, length(bound.center - center) + bound.radius);
+    }
+
+    uint32_t index = static_cast<uint32_t>(cells.size());
+    cells.push_back(BVHGroup::Cell{dsphere(center, radius), begin, end - begin});
+
+    if ((end - begin) <= maximumChildrenPerCell) return index;
+
+    dvec3 size = centers.max - centers.min;
+    int axis = (size.x >= size.y && size.x >= size.z) ? 0 : ((size.y >= size.z) ? 1 : 2);
+
+    uint32_t mid = begin + (end - begin) / 2;
+    std::nth_element(children.begin() + begin, children.begin() + mid, children.begin() + end, [axis](const BoundedChild& lhs, const BoundedChild& rhs) {
+        return lhs.bound.center[axis] < rhs.bound.center[axis];
+    });
+
+    // first child cell immediately follows its parent so only the index of the second child cell needs to be recorded
+    buildCell(cells, children, begin, mid, maximumChildrenPerCell);
+    uint32_t second = buildCell(cells, children, mid, end, maximumChildrenPerCell);
+
+    cells[index].first = second;
+    cells[index].count = 0;
+
+    return index;
+}
+
+static bool validCells(const BVHGroup::Cells& cells, uint32_t numBoundedChildren)
+{
+    if (cells.empty()) return numBoundedChildren == 0;
+
+    // walk the hierarchy from the root cell, as the traversals do, checking that the leaf cells reached cover each of the bounded children exactly once
+    const uint64_t numCells = cells.size();
+    std::vector<bool> covered(numBoundedChildren, false);
+    uint64_t numCovered = 0;
+
+    std::vector<uint64_t> indices{0};
+    while (!indices.empty())
+    {
+        uint64_t i = indices.back();
+        indices.pop_back();
+
+        const auto& cell = cells[i];
+        if (cell.count == 0)
+        {
+            // internal cells have two child cells, the first immediately following and the second after the first's subtree, so each index must be further along than its parent's to guarantee termination
+            if ((i + 1) >= numCells || cell.first <= (i + 1) || cell.first >= numCells) return false;
+
+            indices.push_back(cell.first);
+            indices.push_back(i + 1);
+        }
+        else
+        {
+            if ((uint64_t(cell.first) + uint64_t(cell.count)) > numBoundedChildren) return false;
+
+            for (uint32_t c = cell.first; c < cell.first + cell.count; ++c)
+            {
+                if (covered[c]) return false;
+                covered[c] = true;
+            }
+            numCovered += cell.count;
+        }
+    }
+
+    return numCovered == numBoundedChildren;
+}
+
+BVHGroup::BVHGroup(Allocator* allocator) :
+    Inherit(allocator)
+{
+}
+
+BVHGroup::~BVHGroup()
+{
+}
+
+void BVHGroup::build(std::size_t maximumChildrenPerCell)
+{
+    BoundedChildren bounded;
+    Children unbounded;
+    for (auto& child : _children)
+    {
+        auto bound = computeBound(child.get());
+        if (bound.valid())
+            bounded.push_back(BoundedChild{bound, child});
+        else
+            unbounded.push_back(child);
+    }
+
+    _cells.clear();
+    if (!bounded.empty()) buildCell(_cells, bounded, 0, static_cast<uint32_t>(bounded.size()), static_cast<uint32_t>(std::max(maximumChildrenPerCell, std::size_t(1))));
+
+    // reorder the children so each leaf cell references a contiguous range, with the unbounded children last
+    _numBoundedChildren = static_cast<uint32_t>(bounded.size());
+    _children.clear();
+    for (auto& child : bounded) _children.push_back(child.node);
+    for (auto& child : unbounded) _children.push_back(child);
+}
+
+void BVHGroup::read(Input& input)
+{
+    Group::read(input);
+
+    input.read("NumBoundedChildren", _numBoundedChildren);
+
+    _cells.resize(input.readValue<uint32_t>("NumCells"));
+    for (auto& cell : _cells)
+    {
+        input.read("Bound", cell.bound);
+        input.read("First", cell.first);
+        input.read("Count", cell.count);
+    }
+
+    if (_numBoundedChildren > _children.size() || !validCells(_cells, _numBoundedChildren))
+    {
+        std::cout << "Warning: BVHGroup::read() hierarchy doesn't match the children, discarding hierarchy so all children are traversed." << std::endl;
+        _cells.clear();
+        _numBoundedChildren = 0;
+    }
+}
+
+void BVHGroup::write(Output& output) const
+{
+    Group::write(output);
+
+    output.write("NumBoundedChildren", _numBoundedChildren);
+
+    output.writeValue<uint32_t>("NumCells", _cells.size());
+    for (auto& cell : _cells)
+    {
+        output.write("Bound", cell.bound);
+        output.write("First", cell.first);
+        output.write("Count", cell.count);
+    }
+}
@@ -75,6 +75,8 @@ void Geometry::write(Output& output) const
 
 void Geometry::compile(Context& context)
 {
+    ConcurrentCompile::Lock lock(context, this);
+
     if (arrays.empty() || commands.empty())
     {
         // Geometry does not contain required arrays or commands
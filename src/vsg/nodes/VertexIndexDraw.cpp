@@ -91,6 +91,8 @@ void VertexIndexDraw::write(Output& output) const
 
 void VertexIndexDraw::compile(Context& context)
 {
+    ConcurrentCompile::Lock lock(context, this);
+
     if (arrays.empty() || !indices)
     {
         // VertexIndexDraw does not contain required arrays and/or indices
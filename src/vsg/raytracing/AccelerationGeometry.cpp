@@ -31,6 +31,8 @@ AccelerationGeometry::AccelerationGeometry(Allocator* allocator) :
 
 void AccelerationGeometry::compile(Context& context)
 {
+    ConcurrentCompile::Lock lock(context, this);
+
     if (!verts) return;                                                    // no data set
     if (_geometry.geometry.triangles.vertexData != VK_NULL_HANDLE) return; // already compiled
 
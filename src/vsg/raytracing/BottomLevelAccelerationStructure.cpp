@@ -28,6 +28,8 @@ BottomLevelAccelerationStructure::BottomLevelAccelerationStructure(Device* devic
 
 void BottomLevelAccelerationStructure::compile(Context& context)
 {
+    ConcurrentCompile::Lock lock(context, this);
+
     if (geometries.size() == 0) return;                    // no data
     if (_vkGeometries.size() == geometries.size()) return; // already compiled
 
@@ -42,6 +42,8 @@ void DescriptorAccelerationStructure::write(Output& output) const
 
 void DescriptorAccelerationStructure::compile(Context& context)
 {
+    ConcurrentCompile::Lock lock(context, this);
+
     // check if we have already compiled the imageData.
     if (_vkAccelerationStructures.size() == _accelerationStructures.size()) return;
 
@@ -57,7 +59,7 @@ void DescriptorAccelerationStructure::assignTo(Context& context, VkWriteDescript
     // TODO HERE
     Descriptor::assignTo(context, wds);
 
-    auto descriptorAccelerationStructureInfo = context.scratchMemory->allocate<VkWriteDescriptorSetAccelerationStructureNV>(1);
+    auto descriptorAccelerationStructureInfo = ScratchMemory::threadLocalInScope().allocate<VkWriteDescriptorSetAccelerationStructureNV>(1);
     descriptorAccelerationStructureInfo->sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET_ACCELERATION_STRUCTURE_NV;
     descriptorAccelerationStructureInfo->accelerationStructureCount = static_cast<uint32_t>(_vkAccelerationStructures.size());
     descriptorAccelerationStructureInfo->pAccelerationStructures = _vkAccelerationStructures.data();
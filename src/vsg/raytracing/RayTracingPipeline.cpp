@@ -68,6 +68,8 @@ void RayTracingPipeline::write(Output& output) const
 
 void RayTracingPipeline::compile(Context& context)
 {
+    ConcurrentCompile::Lock lock(context, this);
+
     if (!_implementation[context.deviceID])
     {
         _pipelineLayout->compile(context);
@@ -105,27 +107,30 @@ RayTracingPipeline::Implementation::Implementation(Context& context, RayTracingP
 
     auto shaderStages = rayTracingPipeline->getShaderStages();
 
-    std::vector<VkPipelineShaderStageCreateInfo> shaderStageCreateInfo(shaderStages.size());
+    ScratchMemoryScope scratchMemory;
+
+    auto shaderStageCreateInfo = scratchMemory.allocate<VkPipelineShaderStageCreateInfo>(shaderStages.size());
     for (size_t i = 0; i < shaderStages.size(); ++i)
     {
         const ShaderStage* shaderStage = shaderStages[i];
-        shaderStageCreateInfo[i].pNext = nullptr;
+        shaderStageCreateInfo[i] = {};
         shaderStage->apply(context, shaderStageCreateInfo[i]);
     }
 
-    pipelineInfo.stageCount = static_cast<uint32_t>(shaderStageCreateInfo.size());
-    pipelineInfo.pStages = shaderStageCreateInfo.data();
+    pipelineInfo.stageCount = static_cast<uint32_t>(shaderStages.size());
+    pipelineInfo.pStages = shaderStageCreateInfo;
 
     // assign the RayTracingShaderGroups
     auto& rayTracingShaderGroups = rayTracingPipeline->getRayTracingShaderGroups();
-    std::vector<VkRayTracingShaderGroupCreateInfoNV> shaderGroups(rayTracingShaderGroups.size());
+    auto shaderGroups = scratchMemory.allocate<VkRayTracingShaderGroupCreateInfoNV>(rayTracingShaderGroups.size());
     for (size_t i = 0; i < rayTracingShaderGroups.size(); ++i)
     {
+        shaderGroups[i] = {};
         rayTracingShaderGroups[i]->applyTo(shaderGroups[i]);
     }
 
-    pipelineInfo.groupCount = static_cast<uint32_t>(shaderGroups.size());
-    pipelineInfo.pGroups = shaderGroups.data();
+    pipelineInfo.groupCount = static_cast<uint32_t>(rayTracingShaderGroups.size());
+    pipelineInfo.pGroups = shaderGroups;
 
     pipelineInfo.maxRecursionDepth = rayTracingPipeline->maxRecursionDepth();
 
@@ -39,6 +39,8 @@ TopLevelAccelerationStructure::TopLevelAccelerationStructure(Device* device, All
 
 void TopLevelAccelerationStructure::compile(Context& context)
 {
+    ConcurrentCompile::Lock lock(context, this);
+
     if (geometryInstances.empty()) return; // no data
     if (_instances) return;                // already compiled
 
@@ -55,6 +55,8 @@ void ComputePipeline::write(Output& output) const
 
 void ComputePipeline::compile(Context& context)
 {
+    ConcurrentCompile::Lock lock(context, this);
+
     if (!_implementation[context.deviceID])
     {
         _pipelineLayout->compile(context);
@@ -73,6 +75,8 @@ ComputePipeline::Implementation::Implementation(Context& context, Device* device
     _shaderStage(shaderStage),
     _allocator(allocator)
 {
+    ScratchMemoryScope scratchMemory;
+
     VkPipelineShaderStageCreateInfo stageInfo = {};
     stageInfo.pNext = nullptr;
     shaderStage->apply(context, stageInfo);
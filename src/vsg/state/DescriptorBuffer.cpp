@@ -70,6 +70,8 @@ void DescriptorBuffer::write(Output& output) const
 
 void DescriptorBuffer::compile(Context& context)
 {
+    ConcurrentCompile::Lock lock(context, this);
+
     // check if already compiled
     if (_bufferDataList.size() < _dataList.size())
     {
@@ -87,7 +89,7 @@ void DescriptorBuffer::assignTo(Context& context, VkWriteDescriptorSet& wds) con
 {
     Descriptor::assignTo(context, wds);
 
-    auto pBufferInfo = context.scratchMemory->allocate<VkDescriptorBufferInfo>(_bufferDataList.size());
+    auto pBufferInfo = ScratchMemory::threadLocalInScope().allocate<VkDescriptorBufferInfo>(_bufferDataList.size());
     wds.descriptorCount = static_cast<uint32_t>(_bufferDataList.size());
     wds.pBufferInfo = pBufferInfo;
 
@@ -68,6 +68,8 @@ void DescriptorImage::write(Output& output) const
 
 void DescriptorImage::compile(Context& context)
 {
+    ConcurrentCompile::Lock lock(context, this);
+
     if (_samplerImages.empty()) return;
 
     auto& vkd = _vulkanData[context.deviceID];
@@ -94,7 +96,7 @@ void DescriptorImage::assignTo(Context& context, VkWriteDescriptorSet& wds) cons
     auto& vkd = _vulkanData[context.deviceID];
 
     // convert from VSG to Vk
-    auto pImageInfo = context.scratchMemory->allocate<VkDescriptorImageInfo>(vkd.imageDataList.size());
+    auto pImageInfo = ScratchMemory::threadLocalInScope().allocate<VkDescriptorImageInfo>(vkd.imageDataList.size());
     wds.descriptorCount = static_cast<uint32_t>(vkd.imageDataList.size());
     wds.pImageInfo = pImageInfo;
     for (size_t i = 0; i < vkd.imageDataList.size(); ++i)
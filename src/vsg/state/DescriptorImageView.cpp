@@ -45,6 +45,8 @@ void DescriptorImageView::write(Output& output) const
 
 void DescriptorImageView::compile(Context& context)
 {
+    ConcurrentCompile::Lock lock(context, this);
+
     // check if we have already compiled the imageData.
     if (_compiled) return;
 
@@ -78,7 +80,7 @@ void DescriptorImageView::assignTo(Context& context, VkWriteDescriptorSet& wds)
     Descriptor::assignTo(context, wds);
 
     // convert from VSG to Vk
-    auto pImageInfo = context.scratchMemory->allocate<VkDescriptorImageInfo>(_imageDataList.size());
+    auto pImageInfo = ScratchMemory::threadLocalInScope().allocate<VkDescriptorImageInfo>(_imageDataList.size());
     wds.descriptorCount = static_cast<uint32_t>(_imageDataList.size());
     wds.pImageInfo = pImageInfo;
 
@@ -18,7 +18,7 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 
 using namespace vsg;
 
-#define USE_MUTEX 0
+#define USE_MUTEX 1
 
 DescriptorSet::DescriptorSet()
 {
@@ -62,6 +62,8 @@ void DescriptorSet::write(Output& output) const
 
 void DescriptorSet::compile(Context& context)
 {
+    ConcurrentCompile::Lock lock(context, this);
+
     if (!_implementation[context.deviceID])
     {
         // make sure all the contributing objects are compiled
@@ -69,7 +71,7 @@ void DescriptorSet::compile(Context& context)
         for (auto& descriptor : _descriptors) descriptor->compile(context);
 
 #if USE_MUTEX
-        std::scoped_lock<std::mutex> lock(context.descriptorPool->getMutex());
+        std::scoped_lock<std::mutex> poolLock(context.descriptorPool->getMutex());
 #endif
         _implementation[context.deviceID] = DescriptorSet::Implementation::create(context.device, context.descriptorPool, _descriptorSetLayout);
         _implementation[context.deviceID]->assign(context, _descriptors);
@@ -113,7 +115,9 @@ void DescriptorSet::Implementation::assign(Context& context, const Descriptors&
 
     if (_descriptors.empty()) return;
 
-    VkWriteDescriptorSet* descriptorWrites = context.scratchMemory->allocate<VkWriteDescriptorSet>(_descriptors.size());
+    ScratchMemoryScope scratchMemory;
+
+    VkWriteDescriptorSet* descriptorWrites = scratchMemory.allocate<VkWriteDescriptorSet>(_descriptors.size());
 
     for (size_t i = 0; i < _descriptors.size(); ++i)
     {
@@ -122,9 +126,6 @@ void DescriptorSet::Implementation::assign(Context& context, const Descriptors&
     }
 
     vkUpdateDescriptorSets(*_device, static_cast<uint32_t>(_descriptors.size()), descriptorWrites, 0, nullptr);
-
-    // clean up scratch memory so it can be reused.
-    context.scratchMemory->release();
 }
 
 //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -172,6 +173,8 @@ void BindDescriptorSets::write(Output& output) const
 
 void BindDescriptorSets::compile(Context& context)
 {
+    ConcurrentCompile::Lock lock(context, this);
+
     auto& vkd = _vulkanData[context.deviceID];
 
     // no need to compile if already compiled
@@ -230,6 +233,8 @@ void BindDescriptorSet::write(Output& output) const
 
 void BindDescriptorSet::compile(Context& context)
 {
+    ConcurrentCompile::Lock lock(context, this);
+
     auto& vkd = _vulkanData[context.deviceID];
 
     // no need to compile if already compiled
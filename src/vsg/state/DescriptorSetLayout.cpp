@@ -64,6 +64,8 @@ void DescriptorSetLayout::write(Output& output) const
 
 void DescriptorSetLayout::compile(Context& context)
 {
+    ConcurrentCompile::Lock lock(context, this);
+
     if (!_implementation[context.deviceID]) _implementation[context.deviceID] = DescriptorSetLayout::Implementation::create(context.device, _descriptorSetLayoutBindings);
 }
 
@@ -27,7 +27,7 @@ void DescriptorTexelBufferView::assignTo(Context& context, VkWriteDescriptorSet&
 {
     Descriptor::assignTo(context, wds);
 
-    auto texelBufferViews = context.scratchMemory->allocate<VkBufferView>(_texelBufferViewList.size());
+    auto texelBufferViews = ScratchMemory::threadLocalInScope().allocate<VkBufferView>(_texelBufferViewList.size());
     wds.descriptorCount = static_cast<uint32_t>(_texelBufferViewList.size());
     wds.pTexelBufferView = texelBufferViews;
 
@@ -83,6 +83,8 @@ void GraphicsPipeline::write(Output& output) const
 
 void GraphicsPipeline::compile(Context& context)
 {
+    ConcurrentCompile::Lock lock(context, this);
+
     if (!_implementation[context.deviceID])
     {
         _pipelineLayout->compile(context);
@@ -122,16 +124,18 @@ GraphicsPipeline::Implementation::Implementation(Context& context, Device* devic
     pipelineInfo.basePipelineHandle = VK_NULL_HANDLE;
     pipelineInfo.pNext = nullptr;
 
-    std::vector<VkPipelineShaderStageCreateInfo> shaderStageCreateInfo(shaderStages.size());
+    ScratchMemoryScope scratchMemory;
+
+    auto shaderStageCreateInfo = scratchMemory.allocate<VkPipelineShaderStageCreateInfo>(shaderStages.size());
     for (size_t i = 0; i < shaderStages.size(); ++i)
     {
         const ShaderStage* shaderStage = shaderStages[i];
-        shaderStageCreateInfo[i].pNext = nullptr;
+        shaderStageCreateInfo[i] = {};
         shaderStage->apply(context, shaderStageCreateInfo[i]);
     }
 
-    pipelineInfo.stageCount = static_cast<uint32_t>(shaderStageCreateInfo.size());
-    pipelineInfo.pStages = shaderStageCreateInfo.data();
+    pipelineInfo.stageCount = static_cast<uint32_t>(shaderStages.size());
+    pipelineInfo.pStages = shaderStageCreateInfo;
 
     for (auto pipelineState : _pipelineStates)
     {
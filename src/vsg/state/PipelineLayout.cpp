@@ -81,6 +81,8 @@ void PipelineLayout::write(Output& output) const
 
 void PipelineLayout::compile(Context& context)
 {
+    ConcurrentCompile::Lock lock(context, this);
+
     if (!_implementation[context.deviceID])
     {
         for (auto dsl : _descriptorSetLayouts)
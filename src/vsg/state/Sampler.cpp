@@ -89,6 +89,8 @@ void Sampler::write(Output& output) const
 
 void Sampler::compile(Context& context)
 {
+    ConcurrentCompile::Lock lock(context, this);
+
     if (_implementation[context.deviceID]) return;
 
     _implementation[context.deviceID] = Implementation::create(context.device, _samplerInfo);
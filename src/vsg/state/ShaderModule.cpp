@@ -85,6 +85,8 @@ void ShaderModule::write(Output& output) const
 
 void ShaderModule::compile(Context& context)
 {
+    ConcurrentCompile::Lock lock(context, this);
+
     if (!_implementation[context.deviceID]) _implementation[context.deviceID] = Implementation::create(context.device, this);
 }
 
@@ -110,8 +110,8 @@ void ShaderStage::apply(Context& context, VkPipelineShaderStageCreateInfo& stage
         }
 
         // allocate temporary memoory to pack the specialization map and data into.
-        auto mapEntries = context.scratchMemory->allocate<VkSpecializationMapEntry>(_specializationConstants.size());
-        auto packedData = context.scratchMemory->allocate<uint8_t>(packedDataSize);
+        auto mapEntries = ScratchMemory::threadLocalInScope().allocate<VkSpecializationMapEntry>(_specializationConstants.size());
+        auto packedData = ScratchMemory::threadLocalInScope().allocate<uint8_t>(packedDataSize);
         uint32_t offset = 0;
         uint32_t i = 0;
         for (auto& [id, data] : _specializationConstants)
@@ -121,7 +121,7 @@ void ShaderStage::apply(Context& context, VkPipelineShaderStageCreateInfo& stage
             offset += static_cast<uint32_t>(data->dataSize());
         }
 
-        auto specializationInfo = context.scratchMemory->allocate<VkSpecializationInfo>(1);
+        auto specializationInfo = ScratchMemory::threadLocalInScope().allocate<VkSpecializationInfo>(1);
 
         stageInfo.pSpecializationInfo = specializationInfo;
 
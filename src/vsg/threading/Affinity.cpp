@@ -12,6 +12,8 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 
 #include <vsg/threading/Affinity.h>
 
+#include <iostream>
+
 #ifdef _WIN32
 
 #    include <process.h>
@@ -22,7 +24,7 @@ static void win32_setAffinity(HANDLE tid, const vsg::Affinity& affinity)
     uint32_t numProcessors = std::thread::hardware_concurrency();
 
     DWORD_PTR affinityMask = 0x0;
-    if (affinity)
+    if (!affinity.cpus.empty())
     {
         for (auto cpu : affinity.cpus)
         {
@@ -54,6 +56,11 @@ void vsg::setAffinity(const Affinity& affinity)
     win32_setAffinity(GetCurrentThread(), affinity);
 }
 
+std::vector<vsg::Affinity> vsg::getNumaNodes()
+{
+    return {Affinity(0, std::thread::hardware_concurrency())};
+}
+
 #elif defined(__APPLE__)
 
 #    include <mach/mach.h>
@@ -64,7 +71,7 @@ static void macos_setAffinity(pthread_t thread_native_handle, const vsg::Affinit
     uint32_t numProcessors = std::thread::hardware_concurrency();
 
     integer_t cpuset = 0;
-    if (affinity)
+    if (!affinity.cpus.empty())
     {
         for (auto cpu : affinity.cpus)
         {
@@ -98,8 +105,104 @@ void vsg::setAffinity(const Affinity& affinity)
     macos_setAffinity(pthread_self(), affinity);
 }
 
+std::vector<vsg::Affinity> vsg::getNumaNodes()
+{
+    return {Affinity(0, std::thread::hardware_concurrency())};
+}
+
 #else // assume pthreads
 
+#    ifdef __linux__
+#        include <cerrno>
+#        include <cstdlib>
+#        include <cstring>
+#        include <fstream>
+#        include <sstream>
+#        include <string>
+#        include <sys/syscall.h>
+#        include <unistd.h>
+
+#        ifndef MPOL_PREFERRED
+#            define MPOL_PREFERRED 1
+#        endif
+
+// parse a decimal sysfs value, returning false if text isn't a plain number in a sensible range for a cpu or node index
+static bool linux_readValue(const std::string& text, uint32_t& value)
+{
+    if (text.empty() || text.size() > 5 || text.find_first_not_of("0123456789") != std::string::npos) return false;
+
+    value = static_cast<uint32_t>(std::strtoul(text.c_str(), nullptr, 10));
+    return value < 65536;
+}
+
+// parse a sysfs list such as "0-7,16-23", returning an empty set if the list is malformed
+static std::set<uint32_t> linux_readList(const std::string& filename)
+{
+    std::set<uint32_t> values;
+
+    std::ifstream fin(filename);
+    std::string list;
+    if (!fin || !std::getline(fin, list)) return values;
+
+    std::istringstream str(list);
+    std::string range;
+    while (std::getline(str, range, ','))
+    {
+        if (range.empty()) continue;
+
+        auto dash = range.find('-');
+        uint32_t first = 0, last = 0;
+        if (!linux_readValue(range.substr(0, dash), first) || !linux_readValue((dash == std::string::npos) ? range : range.substr(dash + 1), last))
+        {
+            std::cout << "Warning: vsg::getNumaNodes() unable to parse \"" << list << "\" read from " << filename << std::endl;
+            return {};
+        }
+
+        for (uint32_t value = first; value <= last; ++value) values.insert(value);
+    }
+    return values;
+}
+
+static void linux_setMemoryNode(int32_t memoryNode)
+{
+    // call set_mempolicy directly to avoid a dependency on libnuma, the nodemask supports the first 64 nodes.
+    if (memoryNode < 0 || memoryNode >= 64)
+    {
+        if (memoryNode >= 64) std::cout << "Warning: vsg::setAffinity() memoryNode " << memoryNode << " is out of the supported range of 0 to 63." << std::endl;
+        return;
+    }
+
+    unsigned long nodemask = 1UL << memoryNode;
+    long rc = syscall(SYS_set_mempolicy, MPOL_PREFERRED, &nodemask, sizeof(nodemask) * 8 + 1);
+    if (rc != 0)
+    {
+        std::cout << "Warning: vsg::setAffinity() unable to set the memory policy to prefer node " << memoryNode << ", " << std::strerror(errno) << std::endl;
+    }
+}
+
+std::vector<vsg::Affinity> vsg::getNumaNodes()
+{
+    std::vector<Affinity> nodes;
+    for (auto node : linux_readList("/sys/devices/system/node/online"))
+    {
+        Affinity affinity;
+        affinity.cpus = linux_readList("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist");
+        affinity.memoryNode = static_cast<int32_t>(node);
+        if (!affinity.cpus.empty()) nodes.push_back(affinity);
+    }
+
+    if (nodes.empty()) nodes.emplace_back(0, std::thread::hardware_concurrency());
+    return nodes;
+}
+#    else
+static void linux_setMemoryNode(int32_t) {}
+
+std::vector<vsg::Affinity> vsg::getNumaNodes()
+{
+    return {Affinity(0, std::thread::hardware_concurrency())};
+}
+#    endif
+
 static void pthread_setAffinity(pthread_t thread_native_handle, const vsg::Affinity& affinity)
 {
     uint32_t numProcessors = std::thread::hardware_concurrency();
@@ -107,7 +210,7 @@ static void pthread_setAffinity(pthread_t thread_native_handle, const vsg::Affin
     cpu_set_t cpuset;
     CPU_ZERO(&cpuset);
 
-    if (affinity)
+    if (!affinity.cpus.empty())
     {
         for (auto cpu : affinity.cpus)
         {
@@ -132,10 +235,26 @@ static void pthread_setAffinity(pthread_t thread_native_handle, const vsg::Affin
 void vsg::setAffinity(std::thread& thread, const Affinity& affinity)
 {
     pthread_setAffinity(thread.native_handle(), affinity);
+
+#    ifdef __linux__
+    if (affinity.memoryNode >= 0)
+    {
+        // the memory policy can only be set by the thread itself
+        if (thread.get_id() == std::this_thread::get_id())
+        {
+            linux_setMemoryNode(affinity.memoryNode);
+        }
+        else
+        {
+            std::cout << "Warning: vsg::setAffinity(std::thread&, const Affinity&) unable to set the memoryNode of another thread, call vsg::setAffinity(const Affinity&) from within the thread." << std::endl;
+        }
+    }
+#    endif
 }
 
 void vsg::setAffinity(const Affinity& affinity)
 {
     pthread_setAffinity(pthread_self(), affinity);
+    linux_setMemoryNode(affinity.memoryNode);
 }
 #endif
@@ -15,45 +15,80 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 
 using namespace vsg;
 
-OperationQueue::OperationQueue(ref_ptr<ActivityStatus> status) :
+OperationQueue::OperationQueue(ref_ptr<ActivityStatus> status, size_t capacity) :
+    _ring(capacity),
     _status(status)
 {
 }
 
+void OperationQueue::_push(ref_ptr<Operation> operation)
+{
+    // once operations have spilled into the overflow list keep adding to it till it's drained so that FIFO order is preserved.
+    if (_overflowSize.load() == 0 && _ring.push(operation)) return;
+
+    std::scoped_lock lock(_mutex);
+    _overflow.emplace_back(operation);
+    ++_overflowSize;
+}
+
+void OperationQueue::_notify(size_t numAdditions)
+{
+    if (numAdditions == 0) return;
+
+    // advance the epoch before checking for waiting threads, so a thread that registers as waiting after this check is guaranteed to see the new epoch and not park.
+    _epoch.fetch_add(1);
+    if (_numWaiting.load() == 0) return;
+
+    std::scoped_lock lock(_mutex);
+    if (numAdditions == 1)
+        _cv.notify_one();
+    else
+        _cv.notify_all();
+}
+
 ref_ptr<Operation> OperationQueue::take()
 {
-    std::unique_lock lock(_mutex);
+    ref_ptr<Operation> operation;
+    if (_ring.pop(operation)) return operation;
 
-    if (_queue.empty()) return {};
+    if (_overflowSize.load() == 0) return {};
 
-    ref_ptr<Operation> operation = _queue.front();
+    std::scoped_lock lock(_mutex);
 
-    _queue.erase(_queue.begin());
+    // recheck the ring as the overflow list only holds operations added after those in the ring.
+    if (_ring.pop(operation)) return operation;
 
+    if (_overflow.empty()) return {};
+
+    operation = _overflow.front();
+    _overflow.pop_front();
+    --_overflowSize;
     return operation;
 }
 
 ref_ptr<Operation> OperationQueue::take_when_avilable()
 {
-    std::chrono::duration waitDuration = std::chrono::milliseconds(100);
+    while (_status->active())
+    {
+        uint64_t epoch = _epoch.load();
 
-    std::unique_lock lock(_mutex);
+        if (auto operation = take()) return operation;
 
-    // wait to the conditional variable signals that an operation has been added
-    while (_queue.empty() && _status->active())
-    {
-        //std::cout<<"Waiting on condition variable"<<std::endl;
-        _cv.wait_for(lock, waitDuration);
+        // park till add() advances the epoch or release() is called.
+        ++_numWaiting;
+        {
+            std::unique_lock lock(_mutex);
+            _cv.wait(lock, [&]() { return _epoch.load() != epoch || _status->cancel(); });
+        }
+        --_numWaiting;
     }
 
     // if the threads we are associated with should no longer running go for a quick exit and return nothing.
-    if (_status->cancel())
-    {
-        return {};
-    }
+    return {};
+}
 
-    // remove and return the head of the queue
-    ref_ptr<Operation> operation = _queue.front();
-    _queue.erase(_queue.begin());
-    return operation;
+void OperationQueue::release()
+{
+    std::scoped_lock lock(_mutex);
+    _cv.notify_all();
 }
@@ -10,45 +10,178 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 
 </editor-fold> */
 
-#include <vsg/io/Options.h>
 #include <vsg/threading/OperationThreads.h>
 
 using namespace vsg;
 
+// the OperationThreads and work stealing queue index of the calling thread, used to route operations added from within running operations to the thread's own queue.
+static thread_local const OperationThreads* s_operationThreads = nullptr;
+static thread_local uint32_t s_threadIndex = 0;
+
+// iterations run(Latch&) spins checking for operations added by the operations still running before parking on the latch
+static constexpr uint32_t s_runSpinCount = 1024;
+
+class OperationThreads::SharedQueue : public Inherit<OperationQueue, SharedQueue>
+{
+public:
+    SharedQueue(OperationThreads* in_operationThreads, ref_ptr<ActivityStatus> in_status) :
+        Inherit(in_status),
+        operationThreads(in_operationThreads) {}
+
+    std::atomic<OperationThreads*> operationThreads;
+
+protected:
+    void _notify(size_t numAdditions) override
+    {
+        OperationQueue::_notify(numAdditions);
+
+        if (numAdditions == 0) return;
+        if (auto threads = operationThreads.load()) threads->_notify();
+    }
+};
+
 OperationThreads::OperationThreads(uint32_t numThreads, ref_ptr<ActivityStatus> in_status) :
     status(in_status)
 {
     if (!status) status = ActivityStatus::create();
-    queue = new OperationQueue(status);
+    queue = new SharedQueue(this, status);
 
-    auto run = [](ref_ptr<OperationQueue> q, ref_ptr<ActivityStatus> thread_status) {
-        while (thread_status->active())
+    for (size_t i = 0; i < numThreads; ++i)
+    {
+        _workQueues.emplace_back(WorkStealingQueue::create());
+    }
+
+    for (uint32_t i = 0; i < numThreads; ++i)
+    {
+        threads.emplace_back(&OperationThreads::_runThread, this, i);
+    }
+}
+
+uint32_t OperationThreads::_threadIndex() const
+{
+    return (s_operationThreads == this) ? s_threadIndex : static_cast<uint32_t>(_workQueues.size());
+}
+
+void OperationThreads::add(ref_ptr<Operation> operation)
+{
+    uint32_t index = _threadIndex();
+    if (index < _workQueues.size())
+    {
+        _workQueues[index]->push(operation);
+    }
+    else
+    {
+        // the shared queue wakes the parked threads itself
+        queue->add(operation);
+        return;
+    }
+
+    _notify();
+}
+
+void OperationThreads::_notify()
+{
+    _epoch.fetch_add(1);
+
+    // only take the mutex when there are parked threads to wake
+    if (_numParked.load() > 0)
+    {
+        std::scoped_lock lock(_parkMutex);
+        _parkCV.notify_one();
+    }
+}
+
+ref_ptr<Operation> OperationThreads::_next(uint32_t index)
+{
+    uint32_t numQueues = static_cast<uint32_t>(_workQueues.size());
+    if (index < numQueues)
+    {
+        if (auto operation = _workQueues[index]->take()) return operation;
+    }
+
+    if (auto operation = queue->take()) return operation;
+
+    // steal from the other threads' queues, starting with the next thread along to spread thieves across the victims
+    for (uint32_t i = 1; i <= numQueues; ++i)
+    {
+        uint32_t victim = (index + i) % numQueues;
+        if (victim == index) continue;
+
+        if (auto operation = _workQueues[victim]->steal()) return operation;
+    }
+
+    return {};
+}
+
+void OperationThreads::_runThread(uint32_t index)
+{
+    s_operationThreads = this;
+    s_threadIndex = index;
+
+    while (status->active())
+    {
+        uint64_t epoch = _epoch.load();
+
+        if (auto operation = _next(index))
         {
-            ref_ptr<Operation> operation = q->take_when_avilable();
-            if (operation)
-            {
-                operation->run();
-            }
+            operation->run();
+            continue;
         }
-    };
 
-    for (size_t i = 0; i < numThreads; ++i)
-    {
-        threads.emplace_back(run, std::ref(queue), std::ref(status));
+        // no operations available so park until one is added, the epoch check avoids missing an addition made since the search started
+        ++_numParked;
+        {
+            std::unique_lock lock(_parkMutex);
+            _parkCV.wait(lock, [&]() { return _epoch.load() != epoch || status->cancel(); });
+        }
+        --_numParked;
     }
+
+    s_operationThreads = nullptr;
 }
 
 void OperationThreads::run()
 {
-    while (ref_ptr<Operation> operation = queue->take())
+    uint32_t index = _threadIndex();
+    while (ref_ptr<Operation> operation = _next(index))
     {
         operation->run();
     }
 }
 
+void OperationThreads::run(Latch& latch)
+{
+    uint32_t index = _threadIndex();
+    while (!latch.is_ready())
+    {
+        uint64_t epoch = _epoch.load();
+
+        if (auto operation = _next(index))
+        {
+            operation->run();
+            continue;
+        }
+
+        // remaining operations are running on other threads, so help with any they add or park till they release the latch
+        if (!spin_wait(s_runSpinCount, [&]() { return latch.is_ready() || _epoch.load() != epoch; }))
+        {
+            latch.wait();
+        }
+    }
+}
+
 void OperationThreads::stop()
 {
     status->set(false);
+    {
+        std::scoped_lock lock(_parkMutex);
+        _parkCV.notify_all();
+    }
+    queue->release();
+
+    // the queue may be held beyond the lifetime of this OperationThreads, so stop it waking threads that no longer exist
+    if (auto sharedQueue = queue.cast<SharedQueue>()) sharedQueue->operationThreads = nullptr;
+
     for (auto& thread : threads)
     {
         thread.join();
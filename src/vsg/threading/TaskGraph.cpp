@@ -0,0 +1,112 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2020 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/threading/TaskGraph.h>
+
+#include <iostream>
+
+using namespace vsg;
+
+void TaskGraph::Task::run()
+{
+    if (function) function();
+    graph->_completed(this);
+}
+
+TaskGraph::TaskGraph()
+{
+}
+
+TaskGraph::~TaskGraph()
+{
+}
+
+TaskGraph::Task* TaskGraph::add(Function function)
+{
+    ref_ptr<Task> task(new Task);
+    task->function = function;
+    task->graph = this;
+    _tasks.push_back(task);
+    return task.get();
+}
+
+void TaskGraph::precede(Task* before, Task* after)
+{
+    before->successors.push_back(after);
+    ++(after->numDependencies);
+}
+
+bool TaskGraph::run(OperationThreads* operationThreads)
+{
+    if (_tasks.empty()) return true;
+
+    // sort the tasks into dependency order, both to check for cycles and to provide the order to run them in serially.
+    std::vector<Task*> ordered;
+    ordered.reserve(_tasks.size());
+    for (auto& task : _tasks)
+    {
+        task->joinCount = task->numDependencies;
+        if (task->numDependencies == 0) ordered.push_back(task.get());
+    }
+
+    for (size_t i = 0; i < ordered.size(); ++i)
+    {
+        for (auto successor : ordered[i]->successors)
+        {
+            if (--(successor->joinCount) == 0) ordered.push_back(successor);
+        }
+    }
+
+    if (ordered.size() != _tasks.size())
+    {
+        std::cout << "Warning: TaskGraph::run() dependencies contain a cycle, unable to run " << _tasks.size() << " tasks." << std::endl;
+        return false;
+    }
+
+    if (!operationThreads || operationThreads->threads.empty())
+    {
+        for (auto task : ordered)
+        {
+            if (task->function) task->function();
+        }
+        return true;
+    }
+
+    _operationThreads = operationThreads;
+    _latch = Latch::create(static_cast<int>(_tasks.size()));
+
+    std::vector<ref_ptr<Operation>> roots;
+    for (auto& task : _tasks)
+    {
+        task->joinCount = task->numDependencies;
+        if (task->numDependencies == 0) roots.emplace_back(task);
+    }
+
+    operationThreads->add(roots.begin(), roots.end());
+    operationThreads->run(*_latch);
+
+    _operationThreads = nullptr;
+    return true;
+}
+
+void TaskGraph::_completed(Task* task)
+{
+    // take a local reference as the graph may be rerun, replacing _latch, as soon as the count reaches zero
+    ref_ptr<Latch> latch = _latch;
+
+    for (auto successor : task->successors)
+    {
+        if (--(successor->joinCount) == 0) _operationThreads->add(ref_ptr<Operation>(successor));
+    }
+
+    latch->count_down();
+}
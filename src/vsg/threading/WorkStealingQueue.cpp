@@ -0,0 +1,123 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2020 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/threading/WorkStealingQueue.h>
+
+using namespace vsg;
+
+// Implementation follows "Correct and Efficient Work-Stealing for Weak Memory Models", Le, Pop, Cohen and Zappa Nardelli, 2013.
+
+WorkStealingQueue::WorkStealingQueue(uint32_t initialCapacity)
+{
+    // capacity must be a power of two so that indices can be wrapped with a mask
+    int64_t capacity = 2;
+    while (capacity < static_cast<int64_t>(initialCapacity)) capacity *= 2;
+
+    _arrays.emplace_back(new Array(capacity));
+    _array.store(_arrays.back().get(), std::memory_order_relaxed);
+}
+
+WorkStealingQueue::~WorkStealingQueue()
+{
+    // release any operations that were never run
+    Array* array = _array.load(std::memory_order_relaxed);
+    for (int64_t i = _top.load(std::memory_order_relaxed); i < _bottom.load(std::memory_order_relaxed); ++i)
+    {
+        if (auto operation = array->get(i)) operation->unref();
+    }
+}
+
+WorkStealingQueue::Array* WorkStealingQueue::_grow(Array* array, int64_t bottom, int64_t top)
+{
+    auto newArray = new Array(array->capacity * 2);
+    for (int64_t i = top; i < bottom; ++i)
+    {
+        newArray->put(i, array->get(i));
+    }
+    _arrays.emplace_back(newArray);
+    return newArray;
+}
+
+void WorkStealingQueue::push(ref_ptr<Operation> operation)
+{
+    if (!operation) return;
+
+    int64_t bottom = _bottom.load(std::memory_order_relaxed);
+    int64_t top = _top.load(std::memory_order_acquire);
+    Array* array = _array.load(std::memory_order_relaxed);
+
+    if ((bottom - top) > (array->capacity - 1))
+    {
+        array = _grow(array, bottom, top);
+        _array.store(array, std::memory_order_release);
+    }
+
+    // the deque holds a reference to the operation until it's taken or stolen
+    operation->ref();
+    array->put(bottom, operation.get());
+
+    // release store publishes the operation to thieves that acquire _bottom
+    _bottom.store(bottom + 1, std::memory_order_release);
+}
+
+ref_ptr<Operation> WorkStealingQueue::take()
+{
+    int64_t bottom = _bottom.load(std::memory_order_relaxed) - 1;
+    Array* array = _array.load(std::memory_order_relaxed);
+    _bottom.store(bottom, std::memory_order_relaxed);
+
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int64_t top = _top.load(std::memory_order_relaxed);
+
+    Operation* operation = nullptr;
+    if (top <= bottom)
+    {
+        operation = array->get(bottom);
+        if (top == bottom)
+        {
+            // last operation in the deque so race any thieves for it
+            if (!_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) operation = nullptr;
+            _bottom.store(bottom + 1, std::memory_order_relaxed);
+        }
+    }
+    else
+    {
+        _bottom.store(bottom + 1, std::memory_order_relaxed);
+    }
+
+    if (!operation) return {};
+
+    // transfer the deque's reference to the returned ref_ptr
+    ref_ptr<Operation> result(operation);
+    operation->unref();
+    return result;
+}
+
+ref_ptr<Operation> WorkStealingQueue::steal()
+{
+    int64_t top = _top.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int64_t bottom = _bottom.load(std::memory_order_acquire);
+
+    if (top >= bottom) return {};
+
+    Array* array = _array.load(std::memory_order_acquire);
+    Operation* operation = array->get(top);
+
+    // another thread took the operation first
+    if (!_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) return {};
+
+    // transfer the deque's reference to the returned ref_ptr
+    ref_ptr<Operation> result(operation);
+    operation->unref();
+    return result;
+}
@@ -13,10 +13,13 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <vsg/commands/BindVertexBuffers.h>
 #include <vsg/commands/Commands.h>
 #include <vsg/io/Options.h>
+#include <vsg/maths/transform.h>
 #include <vsg/nodes/Geometry.h>
+#include <vsg/nodes/Group.h>
 #include <vsg/nodes/MatrixTransform.h>
 #include <vsg/nodes/VertexIndexDraw.h>
 #include <vsg/state/StateGroup.h>
+#include <vsg/threading/parallel_for.h>
 #include <vsg/traversals/ComputeBounds.h>
 
 using namespace vsg;
@@ -32,6 +35,38 @@ void ComputeBounds::apply(const vsg::Node& node)
     node.traverse(*this);
 }
 
+void ComputeBounds::apply(const vsg::Group& group)
+{
+    auto& children = group.getChildren();
+    if (!operationThreads || children.size() <= parallelGrainSize)
+    {
+        group.traverse(*this);
+        return;
+    }
+
+    // each chunk of children is traversed by its own ComputeBounds, starting from this traversal's current state, then the chunk bounds are merged
+    std::mutex boundsMutex;
+    parallel_for(operationThreads.get(), 0, children.size(), parallelGrainSize, [&](size_t begin, size_t end) {
+        auto computeBounds = ComputeBounds::create();
+        computeBounds->operationThreads = operationThreads;
+        computeBounds->parallelGrainSize = parallelGrainSize;
+        computeBounds->arrayStateStack.back() = arrayStateStack.back();
+        computeBounds->matrixStack = matrixStack;
+
+        for (size_t i = begin; i < end; ++i)
+        {
+            children[i]->accept(*computeBounds);
+        }
+
+        if (computeBounds->bounds.valid())
+        {
+            std::scoped_lock lock(boundsMutex);
+            bounds.add(computeBounds->bounds.min);
+            bounds.add(computeBounds->bounds.max);
+        }
+    });
+}
+
 void ComputeBounds::apply(const StateGroup& stategroup)
 {
     ArrayState arrayState(arrayStateStack.back());
@@ -91,7 +126,23 @@ void ComputeBounds::apply(const vsg::vec3Array& vertices)
     }
     else
     {
-        auto matrix = matrixStack.back();
-        for (auto vertex : vertices) bounds.add(matrix * vertex);
+        // gather the vertices into batches so they can be transformed using the SIMD vsg::transform(..) implementation
+        constexpr size_t batchSize = 64;
+        vec3 batch[batchSize];
+        size_t count = 0;
+
+        auto& matrix = matrixStack.back();
+        auto add_batch = [&]() {
+            transform(matrix, batch, batch, count);
+            for (size_t i = 0; i < count; ++i) bounds.add(batch[i]);
+            count = 0;
+        };
+
+        for (auto& vertex : vertices)
+        {
+            batch[count++] = vertex;
+            if (count == batchSize) add_batch();
+        }
+        if (count > 0) add_batch();
     }
 }
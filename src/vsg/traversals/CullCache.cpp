@@ -0,0 +1,96 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2020 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/traversals/CullCache.h>
+#include <vsg/ui/ApplicationEvent.h>
+
+#include <algorithm>
+#include <cmath>
+
+using namespace vsg;
+
+CullCache::CullCache()
+{
+}
+
+CullCache::~CullCache()
+{
+}
+
+static dvec3 eyePosition(const dmat4& m)
+{
+    // assumes a rigid view matrix so the inverse rotation is the transpose
+    return dvec3(-(m[0][0] * m[3][0] + m[0][1] * m[3][1] + m[0][2] * m[3][2]),
+                 -(m[1][0] * m[3][0] + m[1][1] * m[3][1] + m[1][2] * m[3][2]),
+                 -(m[2][0] * m[3][0] + m[2][1] * m[3][1] + m[2][2] * m[3][2]));
+}
+
+bool CullCache::withinThresholds(const dmat4& lhs, const dmat4& rhs) const
+{
+    if (lhs == rhs) return true;
+
+    double eyeMovement = length(eyePosition(lhs) - eyePosition(rhs));
+    if (eyeMovement >= eyeMovementThreshold) return false;
+
+    // angle between the corresponding view axes
+    double minCosAngle = 1.0;
+    for (int r = 0; r < 3; ++r)
+    {
+        auto cosAngle = lhs[0][r] * rhs[0][r] + lhs[1][r] * rhs[1][r] + lhs[2][r] * rhs[2][r];
+        minCosAngle = std::min(minCosAngle, cosAngle);
+    }
+    return std::acos(std::max(-1.0, minCosAngle)) < rotationThreshold;
+}
+
+void CullCache::beginView(const FrameStamp* frameStamp, const dmat4& projMatrix, const dmat4& viewMatrix, uint64_t sceneGraphModifiedCount)
+{
+    if (!frameStamp || frameStamp->frameCount != _frameCount || _views.empty())
+    {
+        _viewIndex = 0;
+        _frameCount = frameStamp ? frameStamp->frameCount : 0;
+    }
+    else
+    {
+        ++_viewIndex;
+    }
+
+    if (_viewIndex >= _views.size()) _views.resize(_viewIndex + 1);
+
+    auto& view = _views[_viewIndex];
+
+    // the results recorded last frame become the previous results to test against
+    std::swap(view.previous, view.current);
+    view.current.clear();
+    view.previousPosition = 0;
+
+    // nodes may have been removed since the previous results were recorded, and new nodes allocated at their addresses, so the previous results can't be safely matched
+    if (sceneGraphModifiedCount != view.sceneGraphModifiedCount)
+    {
+        view.previous.clear();
+        view.sceneGraphModifiedCount = sceneGraphModifiedCount;
+    }
+
+    // reuse the previous results while the view is within the thresholds of where they were last evaluated
+    view.reuse = !view.previous.empty() && projMatrix == view.projectionMatrix && withinThresholds(viewMatrix, view.viewMatrix);
+    if (!view.reuse)
+    {
+        view.projectionMatrix = projMatrix;
+        view.viewMatrix = viewMatrix;
+    }
+
+    // only record results while the view is moving slower than the thresholds, as faster moving views would not reuse them and the cost of recording would be wasted
+    bool settled = projMatrix == view.previousProjectionMatrix && withinThresholds(viewMatrix, view.previousViewMatrix);
+    view.previousProjectionMatrix = projMatrix;
+    view.previousViewMatrix = viewMatrix;
+
+    _view = (view.reuse || settled) ? &view : nullptr;
+}
@@ -15,6 +15,7 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <vsg/commands/Draw.h>
 #include <vsg/commands/DrawIndexed.h>
 #include <vsg/maths/transform.h>
+#include <vsg/nodes/BVHGroup.h>
 #include <vsg/nodes/CullNode.h>
 #include <vsg/nodes/Geometry.h>
 #include <vsg/nodes/LOD.h>
@@ -119,6 +120,13 @@ void Intersector::apply(const CullNode& cn)
     if (intersects(cn.getBound())) cn.traverse(*this);
 }
 
+void Intersector::apply(const BVHGroup& bvhGroup)
+{
+    PushPopNode ppn(_nodePath, &bvhGroup);
+
+    bvhGroup.traverseIntersecting(*this, [this](const dsphere& bound) { return intersects(bound); });
+}
+
 void Intersector::apply(const VertexIndexDraw& vid)
 {
     auto& arrayState = arrayStateStack.back();
@@ -129,8 +137,10 @@ void Intersector::apply(const VertexIndexDraw& vid)
 
     PushPopNode ppn(_nodePath, &vid);
 
+    static const InternedString s_boundKey("bound");
+
     sphere bound;
-    if (!vid.getValue("bound", bound))
+    if (!vid.getValue(s_boundKey, bound))
     {
         box bb;
         for (auto& vertex : *arrayState.vertices) bb.add(vertex);
@@ -141,7 +151,7 @@ void Intersector::apply(const VertexIndexDraw& vid)
             bound.radius = length(bb.max - bb.min) * 0.5f;
 
             // hacky but better to reuse results.  Perhaps use a std::map<> to avoid a breaking const, or make the vistitor non const?
-            const_cast<VertexIndexDraw&>(vid).setValue("bound", bound);
+            const_cast<VertexIndexDraw&>(vid).setValue(s_boundKey, bound);
         }
 
         // std::cout<<"Computed bounding sphere : "<<bound.center<<", "<<bound.radius<<std::endl;
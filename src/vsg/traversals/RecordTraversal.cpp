@@ -15,6 +15,8 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <vsg/io/DatabasePager.h>
 #include <vsg/io/Options.h>
 #include <vsg/maths/plane.h>
+#include <vsg/maths/transform.h>
+#include <vsg/nodes/BVHGroup.h>
 #include <vsg/nodes/CullGroup.h>
 #include <vsg/nodes/CullNode.h>
 #include <vsg/nodes/Group.h>
@@ -24,6 +26,7 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <vsg/nodes/QuadGroup.h>
 #include <vsg/state/StateGroup.h>
 #include <vsg/threading/atomics.h>
+#include <vsg/traversals/CullCache.h>
 #include <vsg/traversals/RecordTraversal.h>
 #include <vsg/ui/ApplicationEvent.h>
 #include <vsg/vk/CommandBuffer.h>
@@ -32,6 +35,7 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 
 using namespace vsg;
 
+#include <algorithm>
 #include <iostream>
 
 #define INLINE_TRAVERSE 1
@@ -47,6 +51,7 @@ RecordTraversal::RecordTraversal(CommandBuffer* commandBuffer, uint32_t maxSlot,
 
 RecordTraversal::~RecordTraversal()
 {
+    if (_cullCache) _cullCache->unref();
     if (_culledPagedLODs) _culledPagedLODs->unref();
     if (_databasePager) _databasePager->unref();
     if (_state) _state->unref();
@@ -78,9 +83,100 @@ void RecordTraversal::setDatabasePager(DatabasePager* dp)
     if (_culledPagedLODs) _culledPagedLODs->ref();
 }
 
+void RecordTraversal::setCullCache(CullCache* cullCache)
+{
+    if (cullCache == _cullCache) return;
+
+    if (_cullCache) _cullCache->unref();
+
+    _cullCache = cullCache;
+
+    if (_cullCache) _cullCache->ref();
+}
+
 void RecordTraversal::setProjectionAndViewMatrix(const dmat4& projMatrix, const dmat4& viewMatrix)
 {
     _state->setProjectionAndViewMatrix(projMatrix, viewMatrix);
+
+    if (_cullCache) _cullCache->beginView(_frameStamp, projMatrix, viewMatrix, _databasePager ? _databasePager->sceneGraphModifiedCount.load() : 0);
+
+    _updatePrefetch(viewMatrix);
+}
+
+void RecordTraversal::_updatePrefetch(const dmat4& viewMatrix)
+{
+    _prefetchActive = false;
+
+    if (!_databasePager || !_databasePager->predictivePrefetch || !_frameStamp)
+    {
+        _eyeSamples.clear();
+        return;
+    }
+
+    // only sample the first view of each frame so that multiple views recorded by the same RecordTraversal don't get mistaken for camera motion
+    if (_eyeSamples.empty() || _eyeSamples.back().frameCount != _frameStamp->frameCount)
+    {
+        auto inverseViewMatrix = inverse(viewMatrix);
+        _eyeSamples.push_back(EyeSample{_frameStamp->frameCount, _frameStamp->time, dvec3(inverseViewMatrix[3][0], inverseViewMatrix[3][1], inverseViewMatrix[3][2])});
+        while (_eyeSamples.size() > std::max(_databasePager->prefetchNumFramesToSample, 2u)) _eyeSamples.pop_front();
+    }
+
+    if (_eyeSamples.size() < 2) return;
+
+    auto& oldest = _eyeSamples.front();
+    auto& newest = _eyeSamples.back();
+    double duration = std::chrono::duration<double, std::chrono::seconds::period>(newest.time - oldest.time).count();
+    if (duration <= 0.0) return;
+
+    // extrapolate the eye position assuming constant velocity, the view direction is kept so the predicted view is the current view translated by the displacement
+    dvec3 displacement = (newest.eye - oldest.eye) * (_databasePager->prefetchLookAheadTime / duration);
+    if (length2(displacement) == 0.0) return;
+
+    _prefetchEyeOffset = dvec3(viewMatrix[0][0] * displacement.x + viewMatrix[1][0] * displacement.y + viewMatrix[2][0] * displacement.z,
+                               viewMatrix[0][1] * displacement.x + viewMatrix[1][1] * displacement.y + viewMatrix[2][1] * displacement.z,
+                               viewMatrix[0][2] * displacement.x + viewMatrix[1][2] * displacement.y + viewMatrix[2][2] * displacement.z);
+    _prefetchActive = true;
+}
+
+void RecordTraversal::_prefetch(const PagedLOD& plod)
+{
+    const auto& child = plod.getChild(0);
+    if (child.node) return;
+
+    const auto& sphere = plod.getBound();
+    const auto& proj = _state->projectionMatrixStack.top();
+    const auto& mv = _state->modelviewMatrixStack.top();
+
+    // position of the bounding sphere center in the eye coordinates of the predicted view
+    dvec3 center(mv[0][0] * sphere.x + mv[1][0] * sphere.y + mv[2][0] * sphere.z + mv[3][0] - _prefetchEyeOffset.x,
+                 mv[0][1] * sphere.x + mv[1][1] * sphere.y + mv[2][1] * sphere.z + mv[3][1] - _prefetchEyeOffset.y,
+                 mv[0][2] * sphere.x + mv[1][2] * sphere.y + mv[2][2] * sphere.z + mv[3][2] - _prefetchEyeOffset.z);
+
+    // check against the eye coordinate frustum
+    if (!intersect(_state->_frustumProjected, dsphere(center, sphere.r))) return;
+
+    auto f = -proj[1][1];
+    auto distance = std::abs(center.z);
+    auto rf = sphere.r * f;
+    auto cutoff = child.minimumScreenHeightRatio * distance;
+    if (rf <= cutoff) return;
+
+    // keep the prefetch request alive, once the prediction no longer requires it the DatabasePager discards it when it's next dequeued.
+    plod.framePrefetchLastRequested.exchange(_frameStamp->frameCount);
+
+    // prefetch priorities are in the range 0 to 1 so they always rank below the PagedLOD that are already visible.
+    auto priority = 1.0 - cutoff / rf;
+    bool priorityIncreased = exchange_if_greater(plod.priority, priority);
+
+    auto previousRequestCount = plod.requestCount.fetch_add(1);
+    if (previousRequestCount == 0)
+    {
+        _databasePager->request(ref_ptr<PagedLOD>(const_cast<PagedLOD*>(&plod)));
+    }
+    else if (priorityIncreased)
+    {
+        _databasePager->updatePriority(&plod);
+    }
 }
 
 void RecordTraversal::apply(const Object& object)
@@ -89,14 +185,98 @@ void RecordTraversal::apply(const Object& object)
     object.traverse(*this);
 }
 
-void RecordTraversal::apply(const Group& group)
+void RecordTraversal::_traverse(const Group& group)
 {
-//    std::cout<<"Visiting Group "<<std::endl;
+    // when the CullCache is reusing the previous frame's results there is nothing to batch test
+    const auto& children = group.getChildren();
+    if (children.size() < 4 || (_cullCache && _cullCache->reuse()))
+    {
 #if INLINE_TRAVERSE
-    vsg::Group::t_traverse(group, *this);
+        vsg::Group::t_traverse(group, *this);
 #else
-    group.traverse(*this);
+        group.traverse(*this);
 #endif
+        return;
+    }
+
+    // gather the bounds of the CullNode and CullGroup children so they can be tested against the frustum several at a time,
+    // visible children are then traversed in order without repeating their individual frustum test.
+    enum ChildType : uint8_t
+    {
+        OTHER,
+        CULL_NODE,
+        CULL_GROUP
+    };
+
+    constexpr std::size_t batchSize = 32;
+    t_sphere<State::value_type> bounds[batchSize];
+    uint8_t visible[batchSize];
+    ChildType childTypes[batchSize];
+
+    for (std::size_t start = 0; start < children.size(); start += batchSize)
+    {
+        std::size_t count = std::min(batchSize, children.size() - start);
+        std::size_t numBounds = 0;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            const Node* child = children[start + i].get();
+            const auto& type = child->type_info();
+            if (type == typeid(CullNode))
+            {
+                childTypes[i] = CULL_NODE;
+                bounds[numBounds++] = static_cast<const CullNode*>(child)->getBound();
+            }
+            else if (type == typeid(CullGroup))
+            {
+                childTypes[i] = CULL_GROUP;
+                bounds[numBounds++] = static_cast<const CullGroup*>(child)->getBound();
+            }
+            else
+            {
+                childTypes[i] = OTHER;
+            }
+        }
+
+        if (numBounds > 0) _state->intersect(bounds, numBounds, visible);
+
+        std::size_t boundIndex = 0;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            const Node* child = children[start + i].get();
+            switch (childTypes[i])
+            {
+            case (CULL_NODE):
+                if (_cullCache)
+                {
+                    _cullCache->record(child, visible[boundIndex++], [&](uint16_t) { static_cast<const CullNode*>(child)->traverse(*this); });
+                }
+                else if (visible[boundIndex++])
+                {
+                    static_cast<const CullNode*>(child)->traverse(*this);
+                }
+                break;
+            case (CULL_GROUP):
+                if (_cullCache)
+                {
+                    _cullCache->record(child, visible[boundIndex++], [&](uint16_t) { _traverse(*static_cast<const CullGroup*>(child)); });
+                }
+                else if (visible[boundIndex++])
+                {
+                    _traverse(*static_cast<const CullGroup*>(child));
+                }
+                break;
+            default:
+                child->accept(*this);
+                break;
+            }
+        }
+    }
+}
+
+void RecordTraversal::apply(const Group& group)
+{
+//    std::cout<<"Visiting Group "<<std::endl;
+    _traverse(group);
 }
 
 void RecordTraversal::apply(const QuadGroup& group)
@@ -113,28 +293,37 @@ void RecordTraversal::apply(const LOD& lod)
 {
     auto sphere = lod.getBound();
 
-    // check if lod bounding sphere is in view frustum.
-    if (!_state->intersect(sphere))
+    // select the first child that passes its screen height ratio test, returning 1 + the index of the child, or 0 when no child is visible.
+    auto select = [&]() -> uint16_t {
+        const auto& proj = _state->projectionMatrixStack.top();
+        const auto& mv = _state->modelviewMatrixStack.top();
+        auto f = -proj[1][1];
+
+        auto distance = std::abs(mv[0][2] * sphere.x + mv[1][2] * sphere.y + mv[2][2] * sphere.z + mv[3][2]);
+        auto rf = sphere.r * f;
+
+        const auto& children = lod.getChildren();
+        for (std::size_t i = 0; i < children.size(); ++i)
+        {
+            bool child_visible = rf > (children[i].minimumScreenHeightRatio * distance);
+            if (child_visible) return static_cast<uint16_t>(i + 1);
+        }
+        return 0;
+    };
+
+    if (_cullCache)
     {
+        _cullCache->cull(&lod, _state->_frustumStack.top(), sphere, select, [&](uint16_t result) { lod.getChild(result - 1).node->accept(*this); });
         return;
     }
 
-    const auto& proj = _state->projectionMatrixStack.top();
-    const auto& mv = _state->modelviewMatrixStack.top();
-    auto f = -proj[1][1];
-
-    auto distance = std::abs(mv[0][2] * sphere.x + mv[1][2] * sphere.y + mv[2][2] * sphere.z + mv[3][2]);
-    auto rf = sphere.r * f;
-
-    for (auto child : lod.getChildren())
+    // check if lod bounding sphere is in view frustum.
+    if (!_state->intersect(sphere))
     {
-        bool child_visible = rf > (child.minimumScreenHeightRatio * distance);
-        if (child_visible)
-        {
-            child.node->accept(*this);
-            return;
-        }
+        return;
     }
+
+    if (auto result = select()) lod.getChild(result - 1).node->accept(*this);
 }
 
 void RecordTraversal::apply(const PagedLOD& plod)
@@ -151,6 +340,8 @@ void RecordTraversal::apply(const PagedLOD& plod)
             _culledPagedLODs->highresCulled.emplace_back(&plod);
         }
 
+        if (_prefetchActive) _prefetch(plod);
+
         return;
     }
 
@@ -182,8 +373,10 @@ void RecordTraversal::apply(const PagedLOD& plod)
             }
             else if (_databasePager)
             {
+                ++_databasePager->stats->numHighResMissing;
+
                 auto priority = rf / cutoff;
-                exchange_if_greater(plod.priority, priority);
+                bool priorityIncreased = exchange_if_greater(plod.priority, priority);
 
                 auto previousRequestCount = plod.requestCount.fetch_add(1);
                 if (previousRequestCount == 0)
@@ -191,9 +384,10 @@ void RecordTraversal::apply(const PagedLOD& plod)
                     // we are first request so tell the databasePager about it
                     _databasePager->request(ref_ptr<PagedLOD>(const_cast<PagedLOD*>(&plod)));
                 }
-                else
+                else if (priorityIncreased)
                 {
-                    //std::cout<<"repeat request "<<&plod<<", "<<plod.requestCount.load()<<std::endl;;
+                    // repeat request with a higher priority so let the databasePager reposition it in its queues
+                    _databasePager->updatePriority(&plod);
                 }
             }
         }
@@ -203,6 +397,8 @@ void RecordTraversal::apply(const PagedLOD& plod)
             {
                 _culledPagedLODs->highresCulled.emplace_back(&plod);
             }
+
+            if (_prefetchActive) _prefetch(plod);
         }
     }
 
@@ -227,10 +423,14 @@ void RecordTraversal::apply(const CullGroup& cullGroup)
     // no culling
     cullGroup.traverse(*this);
 #else
-    if (_state->intersect(cullGroup.getBound()))
+    if (_cullCache)
+    {
+        _cullCache->cull(&cullGroup, _state->_frustumStack.top(), cullGroup.getBound(), []() -> uint16_t { return 1; }, [&](uint16_t) { _traverse(cullGroup); });
+    }
+    else if (_state->intersect(cullGroup.getBound()))
     {
         //std::cout<<"Passed node"<<std::endl;
-        cullGroup.traverse(*this);
+        _traverse(cullGroup);
     }
     else
     {
@@ -239,13 +439,22 @@ void RecordTraversal::apply(const CullGroup& cullGroup)
 #endif
 }
 
+void RecordTraversal::apply(const BVHGroup& bvhGroup)
+{
+    bvhGroup.traverseIntersecting(*this, [this](const dsphere& bound) { return _state->intersect(bound); });
+}
+
 void RecordTraversal::apply(const CullNode& cullNode)
 {
 #if 0
     // no culling
     cullNode.traverse(*this);
 #else
-    if (_state->intersect(cullNode.getBound()))
+    if (_cullCache)
+    {
+        _cullCache->cull(&cullNode, _state->_frustumStack.top(), cullNode.getBound(), []() -> uint16_t { return 1; }, [&](uint16_t) { cullNode.traverse(*this); });
+    }
+    else if (_state->intersect(cullNode.getBound()))
     {
         //std::cout<<"Passed node"<<std::endl;
         cullNode.traverse(*this);
@@ -306,6 +515,9 @@ void RecordTraversal::apply(const MatrixTransform& mt)
 // Vulkan nodes
 void RecordTraversal::apply(const Commands& commands)
 {
+    // no CommandBuffer assigned when only culling, such as a CPU only CameraPathReplay
+    if (!_state->_commandBuffer) return;
+
     _state->record();
     for (auto& command : commands.getChildren())
     {
@@ -316,6 +528,8 @@ void RecordTraversal::apply(const Commands& commands)
 void RecordTraversal::apply(const Command& command)
 {
     //    std::cout<<"Visiting Command "<<std::endl;
+    if (!_state->_commandBuffer) return;
+
     _state->record();
     command.record(*(_state->_commandBuffer));
 }
@@ -0,0 +1,179 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2020 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/io/Options.h>
+#include <vsg/traversals/RecordTraversal.h>
+#include <vsg/ui/ApplicationEvent.h>
+#include <vsg/viewer/CameraPath.h>
+
+#include <algorithm>
+#include <iostream>
+#include <thread>
+
+using namespace vsg;
+
+/////////////////////////////////////////////////////////////////////////
+//
+// CameraPath
+//
+CameraPath::CameraPath()
+{
+}
+
+CameraPath::~CameraPath()
+{
+}
+
+void CameraPath::record(double time, const Camera& camera)
+{
+    Sample sample;
+    sample.time = time;
+    if (camera.getProjectionMatrix()) camera.getProjectionMatrix()->get(sample.projectionMatrix);
+    if (camera.getViewMatrix()) camera.getViewMatrix()->get(sample.viewMatrix);
+    samples.push_back(sample);
+}
+
+void CameraPath::read(Input& input)
+{
+    Object::read(input);
+
+    samples.resize(input.readValue<uint32_t>("NumSamples"));
+    for (auto& sample : samples)
+    {
+        input.read("Time", sample.time);
+        input.read("ProjectionMatrix", sample.projectionMatrix);
+        input.read("ViewMatrix", sample.viewMatrix);
+    }
+}
+
+void CameraPath::write(Output& output) const
+{
+    Object::write(output);
+
+    output.writeValue<uint32_t>("NumSamples", samples.size());
+    for (auto& sample : samples)
+    {
+        output.write("Time", sample.time);
+        output.write("ProjectionMatrix", sample.projectionMatrix);
+        output.write("ViewMatrix", sample.viewMatrix);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////
+//
+// RecordCameraPath
+//
+RecordCameraPath::RecordCameraPath(ref_ptr<Camera> in_camera, ref_ptr<CameraPath> in_path) :
+    camera(in_camera),
+    path(in_path)
+{
+    if (!path) path = CameraPath::create();
+}
+
+void RecordCameraPath::apply(FrameEvent& frame)
+{
+    if (!camera) return;
+
+    if (path->samples.empty()) _startTime = frame.time;
+
+    path->record(std::chrono::duration<double, std::chrono::seconds::period>(frame.time - _startTime).count(), *camera);
+}
+
+/////////////////////////////////////////////////////////////////////////
+//
+// CameraPathReplay
+//
+CameraPathReplay::CameraPathReplay(ref_ptr<CameraPath> in_path, ref_ptr<Node> in_scenegraph, ref_ptr<DatabasePager> in_databasePager) :
+    path(in_path),
+    scenegraph(in_scenegraph),
+    databasePager(in_databasePager)
+{
+}
+
+CameraPathReplay::~CameraPathReplay()
+{
+}
+
+CameraPathReplay::Results CameraPathReplay::run()
+{
+    Results results;
+
+    if (!path || path->samples.empty() || !scenegraph) return results;
+
+    if (!databasePager)
+    {
+        databasePager = DatabasePager::create();
+    }
+    else if (databasePager->compileTraversal)
+    {
+        std::cout << "Warning: CameraPathReplay::run() requires a DatabasePager without a CompileTraversal assigned, replay skipped." << std::endl;
+        return results;
+    }
+
+    // reuse the threads of an already started DatabasePager rather than starting a second set
+    if (!databasePager->started()) databasePager->start();
+
+    ref_ptr<RecordTraversal> recordTraversal(new RecordTraversal(nullptr, maxSlot));
+    recordTraversal->setDatabasePager(databasePager);
+
+    auto& samples = path->samples;
+    auto& stats = *(databasePager->stats);
+    auto& pagedLODContainer = *(databasePager->pagedLODContainer);
+
+    // frames run after the end of the path keep the last sample, spaced at the path's average frame interval
+    uint64_t lastSample = samples.size() - 1;
+    double frameInterval = (lastSample > 0 && samples.back().time > samples.front().time) ? (samples.back().time - samples.front().time) / double(lastSample) : (1.0 / 60.0);
+
+    auto startTime = clock::now();
+    clock::time_point settleStartTime;
+    for (uint64_t frameCount = 0; frameCount <= lastSample + maxSettleFrames; ++frameCount)
+    {
+        bool settling = frameCount >= lastSample;
+        auto& sample = samples[std::min(frameCount, lastSample)];
+        double sampleTime = settling ? (sample.time - samples.front().time) + double(frameCount - lastSample) * frameInterval : (sample.time - samples.front().time);
+
+        auto frameTime = startTime + std::chrono::duration_cast<clock::duration>(std::chrono::duration<double, std::chrono::seconds::period>(sampleTime));
+        if (realTime) std::this_thread::sleep_until(frameTime);
+
+        // time to full resolution is measured from the frame that reaches the end of the path, so it doesn't include the time taken to replay the path
+        if (frameCount == lastSample) settleStartTime = clock::now();
+
+        auto frameStamp = FrameStamp::create(frameTime, frameCount);
+
+        databasePager->updateSceneGraph(frameStamp);
+
+        recordTraversal->setFrameStamp(frameStamp);
+        recordTraversal->setProjectionAndViewMatrix(sample.projectionMatrix, sample.viewMatrix);
+
+        auto previousHighResMissing = stats.numHighResMissing.load();
+
+        scenegraph->accept(*recordTraversal);
+
+        bool highResMissing = stats.numHighResMissing.load() != previousHighResMissing;
+
+        ++results.numFrames;
+        if (highResMissing) ++results.numFramesWithMissingHighRes;
+
+        results.peakNumHighResSubgraphs = std::max(results.peakNumHighResSubgraphs, pagedLODContainer.activeList.count + pagedLODContainer.inactiveList.count);
+        results.peakHostMemory = std::max(results.peakHostMemory, VkDeviceSize(databasePager->hostMemoryInUse.load()));
+        results.peakDeviceMemory = std::max(results.peakDeviceMemory, VkDeviceSize(databasePager->deviceMemoryInUse.load()));
+
+        if (settling && !highResMissing)
+        {
+            results.reachedFullResolution = true;
+            results.timeToFullResolution = std::chrono::duration<double, std::chrono::seconds::period>(clock::now() - settleStartTime).count();
+            break;
+        }
+    }
+
+    return results;
+}
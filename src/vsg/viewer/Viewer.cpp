@@ -415,16 +415,22 @@ void Viewer::setupThreading()
 
     _threading = true;
 
-    _frameBlock = FrameBlock::create(_status);
-    _submissionCompleted = Barrier::create(1 + numValidTasks);
+    _frameBlock = FrameBlock::create(_status, threadingSpinCount);
+    _submissionCompleted = Barrier::create(1 + numValidTasks, threadingSpinCount);
 
     // set up required threads for each task
-    for (auto& task : recordAndSubmitTasks)
+    for (size_t taskIndex = 0; taskIndex < recordAndSubmitTasks.size(); ++taskIndex)
     {
+        auto& task = recordAndSubmitTasks[taskIndex];
+        Affinity affinity = (taskIndex < recordThreadAffinities.size()) ? recordThreadAffinities[taskIndex] : Affinity();
+
         if (task->commandGraphs.size() == 1)
         {
             // task only contains a single CommandGraph so keep thread simple
-            auto run = [](ref_ptr<RecordAndSubmitTask> viewer_task, ref_ptr<FrameBlock> viewer_frameBlock, ref_ptr<Barrier> submissionCompleted) {
+            auto run = [](ref_ptr<RecordAndSubmitTask> viewer_task, ref_ptr<FrameBlock> viewer_frameBlock, ref_ptr<Barrier> submissionCompleted, Affinity threadAffinity) {
+                // set the affinity from within the thread so that its memory policy is also applied
+                if (threadAffinity) setAffinity(threadAffinity);
+
                 auto frameStamp = viewer_frameBlock->initial_value;
 
                 // wait for this frame to be signalled
@@ -436,20 +442,20 @@ void Viewer::setupThreading()
                 }
             };
 
-            threads.emplace_back(run, task, _frameBlock, _submissionCompleted);
+            threads.emplace_back(run, task, _frameBlock, _submissionCompleted, affinity);
         }
         else if (task->commandGraphs.size() >= 1)
         {
             // we have multiple CommandGraphs in a single Task so set up a thread per CommandGraph
             struct SharedData : public Inherit<Object, SharedData>
             {
-                SharedData(ref_ptr<RecordAndSubmitTask> in_task, ref_ptr<FrameBlock> in_frameBlock, ref_ptr<Barrier> in_submissionCompleted, uint32_t numThreads) :
+                SharedData(ref_ptr<RecordAndSubmitTask> in_task, ref_ptr<FrameBlock> in_frameBlock, ref_ptr<Barrier> in_submissionCompleted, uint32_t numThreads, uint32_t spinCount) :
                     task(in_task),
                     frameBlock(in_frameBlock),
                     submissionCompletedBarrier(in_submissionCompleted)
                 {
-                    recordStartBarrier = Barrier::create(numThreads);
-                    recordCompletedBarrier = Barrier::create(numThreads);
+                    recordStartBarrier = Barrier::create(numThreads, spinCount);
+                    recordCompletedBarrier = Barrier::create(numThreads, spinCount);
                 }
 
                 void add(CommandBuffers& commandBuffers)
@@ -471,9 +477,11 @@ void Viewer::setupThreading()
                 ref_ptr<Barrier> recordCompletedBarrier;
             };
 
-            ref_ptr<SharedData> sharedData = SharedData::create(task, _frameBlock, _submissionCompleted, static_cast<uint32_t>(task->commandGraphs.size()));
+            ref_ptr<SharedData> sharedData = SharedData::create(task, _frameBlock, _submissionCompleted, static_cast<uint32_t>(task->commandGraphs.size()), threadingSpinCount);
+
+            auto run_primary = [](ref_ptr<SharedData> data, ref_ptr<CommandGraph> commandGraph, Affinity threadAffinity) {
+                if (threadAffinity) setAffinity(threadAffinity);
 
-            auto run_primary = [](ref_ptr<SharedData> data, ref_ptr<CommandGraph> commandGraph) {
                 auto frameStamp = data->frameBlock->initial_value;
 
                 // wait for this frame to be signalled
@@ -499,7 +507,9 @@ void Viewer::setupThreading()
                 }
             };
 
-            auto run_secondary = [](ref_ptr<SharedData> data, ref_ptr<CommandGraph> commandGraph) {
+            auto run_secondary = [](ref_ptr<SharedData> data, ref_ptr<CommandGraph> commandGraph, Affinity threadAffinity) {
+                if (threadAffinity) setAffinity(threadAffinity);
+
                 auto frameStamp = data->frameBlock->initial_value;
 
                 // wait for this frame to be signalled
@@ -519,9 +529,9 @@ void Viewer::setupThreading()
             for (uint32_t i = 0; i < task->commandGraphs.size(); ++i)
             {
                 if (i == 0)
-                    threads.emplace_back(run_primary, sharedData, task->commandGraphs[i]);
+                    threads.emplace_back(run_primary, sharedData, task->commandGraphs[i], affinity);
                 else
-                    threads.emplace_back(run_secondary, sharedData, task->commandGraphs[i]);
+                    threads.emplace_back(run_secondary, sharedData, task->commandGraphs[i], affinity);
             }
         }
     }
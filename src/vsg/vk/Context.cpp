@@ -72,6 +72,78 @@ void BuildAccelerationStructureCommand::record(CommandBuffer& commandBuffer) con
     vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_ACCELERATION_STRUCTURE_BUILD_BIT_NV, VK_PIPELINE_STAGE_ACCELERATION_STRUCTURE_BUILD_BIT_NV, 0, 1, &memoryBarrier, 0, 0, 0, 0);
 }
 
+/////////////////////////////////////////////////////////////////////////////////////////
+//
+// ConcurrentCompile
+//
+ConcurrentCompile::Lock::Lock(Context& context, const Object* object) :
+    _context(context)
+{
+    auto concurrentCompile = context.concurrentCompile.get();
+    if (!concurrentCompile) return;
+
+    std::unique_lock lock(concurrentCompile->_mutex);
+
+    // compile() of an object may be reentered by the thread already compiling it, otherwise wait for the other thread to finish
+    auto threadID = std::this_thread::get_id();
+    concurrentCompile->_cv.wait(lock, [&]() {
+        auto itr = concurrentCompile->_compiling.find(object);
+        return itr == concurrentCompile->_compiling.end() || itr->second == threadID;
+    });
+
+    if (!concurrentCompile->_compiling.emplace(object, threadID).second) return;
+
+    _object = object;
+    _numCommands = context.commands.size();
+    _numBuildCommands = context.buildAccelerationStructureCommands.size();
+
+    // the object was compiled by another batch whose transfers are yet to be submitted
+    if (auto itr = concurrentCompile->_owners.find(object); itr != concurrentCompile->_owners.end() && itr->second != context.semaphore)
+    {
+        context.compileDependencies.insert(itr->second);
+    }
+}
+
+ConcurrentCompile::Lock::~Lock()
+{
+    if (!_object) return;
+
+    auto concurrentCompile = _context.concurrentCompile.get();
+    {
+        std::scoped_lock lock(concurrentCompile->_mutex);
+        concurrentCompile->_compiling.erase(_object);
+
+        // transfers recorded while compiling the object, or the objects it contains, complete when this batch's semaphore is signalled
+        if (_context.semaphore && (_context.commands.size() > _numCommands || _context.buildAccelerationStructureCommands.size() > _numBuildCommands))
+        {
+            concurrentCompile->_owners[_object] = _context.semaphore;
+        }
+    }
+    concurrentCompile->_cv.notify_all();
+}
+
+void ConcurrentCompile::submitted(const Semaphore* semaphore)
+{
+    std::scoped_lock lock(_mutex);
+    for (auto itr = _owners.begin(); itr != _owners.end();)
+    {
+        if (itr->second == semaphore)
+            itr = _owners.erase(itr);
+        else
+            ++itr;
+    }
+}
+
+bool ConcurrentCompile::pending(const Semaphore* semaphore) const
+{
+    std::scoped_lock lock(_mutex);
+    for (auto& [object, owner] : _owners)
+    {
+        if (owner == semaphore) return true;
+    }
+    return false;
+}
+
 /////////////////////////////////////////////////////////////////////////////////////////
 //
 // vsg::Context
@@ -98,7 +170,8 @@ Context::Context(const Context& context) :
     commandPool(context.commandPool),
     deviceMemoryBufferPools(context.deviceMemoryBufferPools),
     stagingMemoryBufferPools(context.stagingMemoryBufferPools),
-    scratchBufferSize(context.scratchBufferSize)
+    scratchBufferSize(context.scratchBufferSize),
+    concurrentCompile(context.concurrentCompile)
 {
     scratchMemory = ScratchMemory::create(4096);
 }
@@ -43,7 +43,7 @@ void Fence::resetFenceAndDependencies()
 {
     for (auto& semaphore : _dependentSemaphores)
     {
-        semaphore->numDependentSubmissions().exchange(0);
+        semaphore->resetDependentSubmissions();
     }
 
     for (auto& commandBuffer : _dependentCommandBuffers)
@@ -84,6 +84,8 @@ BufferData MemoryBufferPools::reserveBufferData(VkDeviceSize totalSize, VkDevice
                 bufferData.offset = reservedBufferSlot.second;
                 bufferData.range = totalSize;
 
+                cumulativeReservedSize += totalSize;
+
 #if REPORT_STATS
                 std::cout << name << " : MemoryBufferPools::reserveBufferData(" << totalSize << ", " << alignment << ", " << bufferUsageFlags << ") _offset = " << bufferData.offset << std::endl;
 #endif
@@ -191,6 +193,8 @@ BufferData MemoryBufferPools::reserveBufferData(VkDeviceSize totalSize, VkDevice
     // std::cout<<name<<" : Allocated new buffer, MemoryBufferPools::reserveBufferData("<<totalSize<<", "<<alignment<<", "<<bufferUsageFlags<<") "<<std::endl;
     bufferData.buffer->bind(deviceMemory, reservedMemorySlot.second);
 
+    cumulativeReservedSize += totalSize;
+
     return bufferData;
 }
 
@@ -249,6 +253,8 @@ MemoryBufferPools::DeviceMemoryOffset MemoryBufferPools::reserveMemory(VkMemoryR
         return DeviceMemoryOffset();
     }
 
+    cumulativeReservedSize += totalSize;
+
     //std::cout << "MemoryBufferPools::reserveMemory() allocated memory at " << reservedSlot.second << std::endl;
     return MemoryBufferPools::DeviceMemoryOffset(deviceMemory, reservedSlot.second);
 }
@@ -39,3 +39,16 @@ Semaphore::~Semaphore()
         vkDestroySemaphore(*_device, _semaphore, _allocator);
     }
 }
+
+void Semaphore::resetDependentSubmissions()
+{
+    std::scoped_lock lock(_mutex);
+    _numDependentSubmissions.exchange(0);
+    _cv.notify_all();
+}
+
+bool Semaphore::waitForDependentSubmissions(uint64_t timeout)
+{
+    std::unique_lock lock(_mutex);
+    return _cv.wait_for(lock, std::chrono::nanoseconds(timeout), [this]() { return _numDependentSubmissions.load() == 0; });
+}
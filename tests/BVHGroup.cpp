@@ -0,0 +1,213 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2020 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/io/ReaderWriter_vsg.h>
+#include <vsg/maths/transform.h>
+#include <vsg/nodes/BVHGroup.h>
+#include <vsg/nodes/CullNode.h>
+#include <vsg/traversals/Intersector.h>
+#include <vsg/traversals/RecordTraversal.h>
+#include <vsg/vk/State.h>
+
+#include "check.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+using namespace vsg;
+
+static std::vector<int> s_visited;
+
+class Leaf : public Inherit<Node, Leaf>
+{
+public:
+    explicit Leaf(int in_id) :
+        id(in_id) {}
+
+    int id;
+
+    void traverse(ConstVisitor&) const override { s_visited.push_back(id); }
+    void traverse(RecordTraversal&) const override { s_visited.push_back(id); }
+};
+
+// intersects the bounds that a line segment passes through, without any geometry so only the leaves reached are recorded
+class SegmentIntersector : public Inherit<Intersector, SegmentIntersector>
+{
+public:
+    SegmentIntersector(const dvec3& in_start, const dvec3& in_end) :
+        start(in_start),
+        end(in_end) {}
+
+    dvec3 start;
+    dvec3 end;
+
+    void pushTransform(const dmat4&) override {}
+    void popTransform() override {}
+
+    bool intersects(const dsphere& bs) override
+    {
+        dvec3 direction = end - start;
+        double t = std::clamp(dot(bs.center - start, direction) / dot(direction, direction), 0.0, 1.0);
+        return length(bs.center - (start + direction * t)) <= bs.radius;
+    }
+
+    bool intersectDraw(uint32_t, uint32_t) override { return false; }
+    bool intersectDrawIndexed(uint32_t, uint32_t) override { return false; }
+};
+
+template<class V>
+static std::vector<int> visit(const Node& node, V& visitor)
+{
+    s_visited.clear();
+    node.accept(visitor);
+    std::sort(s_visited.begin(), s_visited.end());
+    return s_visited;
+}
+
+// a BVHGroup must visit the same leaves as a flat Group of the same children, only culling whole cells that the children would each have been culled from
+static void testTraversal()
+{
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<double> u(-500.0, 500.0), r(0.0, 20.0);
+
+    auto group = Group::create();
+    auto bvhGroup = BVHGroup::create();
+    for (int i = 0; i < 5000; ++i)
+    {
+        // every hundredth child has no bound so is kept outside the hierarchy
+        ref_ptr<Node> child;
+        if (i % 100 == 0)
+            child = Leaf::create(i);
+        else
+            child = CullNode::create(dsphere(dvec3(u(rng), u(rng), u(rng) * 0.2), r(rng)), Leaf::create(i));
+        group->addChild(child);
+        bvhGroup->addChild(child);
+    }
+    bvhGroup->build();
+
+    VSG_CHECK(bvhGroup->getNumBoundedChildren() == 4950);
+    VSG_CHECK(bvhGroup->getChildren().size() == 5000);
+    VSG_CHECK(bvhGroup->getCells().size() > 1);
+
+    RecordTraversal recordTraversal;
+    recordTraversal.setProjectionAndViewMatrix(perspective(1.0, 1.5, 1.0, 1000.0), lookAt(dvec3(0.0, 0.0, 0.0), dvec3(1.0, 0.2, 0.0), dvec3(0.0, 0.0, 1.0)));
+
+    auto expected = visit(*group, recordTraversal);
+    VSG_CHECK(!expected.empty() && expected.size() < 5000);
+    VSG_CHECK(visit(*bvhGroup, recordTraversal) == expected);
+
+    auto intersector = SegmentIntersector::create(dvec3(-600.0, -40.0, 0.0), dvec3(600.0, 40.0, 0.0));
+    expected = visit(*group, *intersector);
+    VSG_CHECK(expected.size() > 50 && expected.size() < 5000);
+    VSG_CHECK(visit(*bvhGroup, *intersector) == expected);
+
+    // once the cells are cleared all the children must be traversed, not just those outside the hierarchy
+    bvhGroup->getCells().clear();
+    VSG_CHECK(visit(*bvhGroup, recordTraversal) == visit(*group, recordTraversal));
+    VSG_CHECK(visit(*bvhGroup, *intersector) == visit(*group, *intersector));
+}
+
+static bool equivalent(const BVHGroup::Cells& lhs, const BVHGroup::Cells& rhs, double epsilon)
+{
+    if (lhs.size() != rhs.size()) return false;
+    for (std::size_t i = 0; i < lhs.size(); ++i)
+    {
+        const auto& l = lhs[i];
+        const auto& r = rhs[i];
+        if (l.first != r.first || l.count != r.count) return false;
+        if (length(l.bound.center - r.bound.center) > epsilon * (1.0 + length(l.bound.center))) return false;
+        if (std::abs(l.bound.radius - r.bound.radius) > epsilon * (1.0 + l.bound.radius)) return false;
+    }
+    return true;
+}
+
+static ref_ptr<BVHGroup> createBVHGroup(std::size_t numChildren)
+{
+    std::mt19937 rng(11);
+    std::uniform_real_distribution<double> u(-100.0, 100.0), r(0.1, 5.0);
+
+    auto bvhGroup = BVHGroup::create();
+    for (std::size_t i = 0; i < numChildren; ++i)
+    {
+        bvhGroup->addChild(CullNode::create(dsphere(dvec3(u(rng), u(rng), u(rng)), r(rng)), Group::create()));
+    }
+    bvhGroup->addChild(Group::create());
+    bvhGroup->build(4);
+    return bvhGroup;
+}
+
+static ref_ptr<BVHGroup> roundTrip(const BVHGroup* bvhGroup, const Path& filename)
+{
+    auto readerWriter = ReaderWriter_vsg::create();
+    VSG_CHECK(readerWriter->write(bvhGroup, filename));
+    auto object = readerWriter->read(filename);
+    std::remove(filename.c_str());
+    return object.cast<BVHGroup>();
+}
+
+// the cells written to .vsgb and .vsgt must be read back unchanged, exactly for binary and to the ascii precision for text
+static void testReadWrite()
+{
+    auto bvhGroup = createBVHGroup(200);
+
+    for (auto& [filename, epsilon] : {std::pair<Path, double>("BVHGroup_test.vsgb", 0.0), std::pair<Path, double>("BVHGroup_test.vsgt", 1e-5)})
+    {
+        auto copy = roundTrip(bvhGroup, filename);
+        VSG_CHECK(copy.valid());
+        if (!copy) continue;
+
+        VSG_CHECK(copy->getChildren().size() == bvhGroup->getChildren().size());
+        VSG_CHECK(copy->getNumBoundedChildren() == bvhGroup->getNumBoundedChildren());
+        VSG_CHECK(equivalent(copy->getCells(), bvhGroup->getCells(), epsilon));
+    }
+}
+
+// read() must discard cells that reference children or cells out of range, or that could loop, so all the children are traversed instead
+static void testCorruptedCells()
+{
+    using Corruption = void (*)(BVHGroup::Cells&);
+    Corruption corruptions[] = {
+        [](BVHGroup::Cells& cells) { cells.back().count += 100; },                                  // leaf past the bounded children
+        [](BVHGroup::Cells& cells) { cells.front().first = static_cast<uint32_t>(cells.size()); }, // second child cell out of range
+        [](BVHGroup::Cells& cells) { cells.front().first = 0; },                                    // internal cell referencing itself
+        [](BVHGroup::Cells& cells) { cells.back().count = 0; cells.back().first = 1; },             // internal cell with no following cell
+        [](BVHGroup::Cells& cells) { cells.clear(); },                                              // bounded children without any cells
+        [](BVHGroup::Cells& cells) { cells.back().count -= 1; },                                    // bounded child not covered by any leaf
+        [](BVHGroup::Cells& cells) { cells.back().first -= 1; },                                    // leaves overlapping
+    };
+
+    for (auto corrupt : corruptions)
+    {
+        auto bvhGroup = createBVHGroup(50);
+        VSG_CHECK(bvhGroup->getCells().size() > 1 && bvhGroup->getCells().front().count == 0 && bvhGroup->getCells().back().count > 1);
+        corrupt(bvhGroup->getCells());
+
+        auto copy = roundTrip(bvhGroup, "BVHGroup_corrupted.vsgb");
+        VSG_CHECK(copy.valid());
+        if (!copy) continue;
+
+        VSG_CHECK(copy->getCells().empty());
+        VSG_CHECK(copy->getNumBoundedChildren() == 0);
+        VSG_CHECK(copy->getChildren().size() == 51);
+    }
+}
+
+int main()
+{
+    testTraversal();
+    testReadWrite();
+    testCorruptedCells();
+    return vsg_test::result();
+}
@@ -0,0 +1,183 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2020 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/maths/transform.h>
+#include <vsg/nodes/CullGroup.h>
+#include <vsg/nodes/CullNode.h>
+#include <vsg/nodes/LOD.h>
+#include <vsg/traversals/CullCache.h>
+#include <vsg/traversals/RecordTraversal.h>
+#include <vsg/ui/ApplicationEvent.h>
+
+#include "check.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <random>
+#include <vector>
+
+using namespace vsg;
+
+static std::vector<int> s_visited;
+
+class Leaf : public Inherit<Node, Leaf>
+{
+public:
+    explicit Leaf(int in_id) :
+        id(in_id) {}
+
+    int id;
+
+    void traverse(RecordTraversal&) const override { s_visited.push_back(id); }
+};
+
+static ref_ptr<Node> createScene()
+{
+    std::mt19937 rng(5);
+    std::uniform_real_distribution<double> u(-5000.0, 5000.0), r(0.0, 20.0);
+
+    auto root = Group::create();
+    int id = 0;
+    for (int g = 0; g < 5000; ++g)
+    {
+        dvec3 center(u(rng), u(rng), u(rng) * 0.05);
+        auto cullGroup = CullGroup::create(dsphere(center, 30.0));
+        for (int i = 0; i < 3; ++i)
+        {
+            dsphere bound(center + dvec3(u(rng) * 0.002, u(rng) * 0.002, u(rng) * 0.001), r(rng));
+            if (i == 1)
+            {
+                auto lod = LOD::create();
+                lod->setBound(bound);
+                lod->addChild(LOD::Child{0.05, Leaf::create(id++)});
+                lod->addChild(LOD::Child{0.0, Leaf::create(id++)});
+                cullGroup->addChild(lod);
+            }
+            else
+            {
+                cullGroup->addChild(CullNode::create(bound, Leaf::create(id++)));
+            }
+        }
+        root->addChild(cullGroup);
+    }
+    return root;
+}
+
+// record the scene with and without the cache, returning true if the same leaves were visited
+static bool compare(Node& scene, RecordTraversal& uncached, RecordTraversal& cached, uint64_t frameCount, const dmat4& projection, const dmat4& view)
+{
+    uncached.setFrameStamp(FrameStamp::create(std::chrono::steady_clock::now(), frameCount));
+    cached.setFrameStamp(FrameStamp::create(std::chrono::steady_clock::now(), frameCount));
+    uncached.setProjectionAndViewMatrix(projection, view);
+    cached.setProjectionAndViewMatrix(projection, view);
+
+    s_visited.clear();
+    scene.accept(uncached);
+    auto expected = s_visited;
+    std::sort(expected.begin(), expected.end());
+
+    s_visited.clear();
+    scene.accept(cached);
+    std::sort(s_visited.begin(), s_visited.end());
+
+    return s_visited == expected;
+}
+
+static dmat4 viewAt(double angle, double x)
+{
+    dvec3 eye(x, 0.0, 10.0);
+    return lookAt(eye, eye + dvec3(std::cos(angle), std::sin(angle), 0.1), dvec3(0.0, 0.0, 1.0));
+}
+
+int main()
+{
+    auto scene = createScene();
+    dmat4 projection = perspective(1.0, 1.5, 1.0, 10000.0);
+
+    // with the default thresholds of 0.0 the cached results must match on every frame, with the previous results reused while the view is static
+    {
+        RecordTraversal uncached, cached;
+        auto cache = CullCache::create();
+        cached.setCullCache(cache);
+
+        int numMismatches = 0, numReused = 0;
+        for (uint64_t frame = 0; frame < 200; ++frame)
+        {
+            // alternate between moving and static views
+            double angle = (frame / 20) % 2 ? 0.01 * static_cast<double>(frame / 20) : 0.01 * static_cast<double>(frame);
+            if (!compare(*scene, uncached, cached, frame, projection, viewAt(angle, 0.0))) ++numMismatches;
+            if (cache->reuse()) ++numReused;
+        }
+        VSG_CHECK(numMismatches == 0);
+        VSG_CHECK(numReused > 0);
+    }
+
+    // with non zero thresholds the frames that re-evaluate must still match
+    {
+        RecordTraversal uncached, cached;
+        auto cache = CullCache::create();
+        cache->eyeMovementThreshold = 1.0;
+        cache->rotationThreshold = 0.01;
+        cached.setCullCache(cache);
+
+        int numMismatches = 0, numEvaluated = 0;
+        for (uint64_t frame = 0; frame < 200; ++frame)
+        {
+            bool match = compare(*scene, uncached, cached, frame, projection, viewAt(0.004 * static_cast<double>(frame), 0.6 * static_cast<double>(frame)));
+            if (!cache->reuse())
+            {
+                ++numEvaluated;
+                if (!match) ++numMismatches;
+            }
+        }
+        VSG_CHECK(numMismatches == 0);
+        VSG_CHECK(numEvaluated > 0 && numEvaluated < 200);
+    }
+
+    // views are cached separately when several are recorded in each frame
+    {
+        RecordTraversal uncached, cached;
+        cached.setCullCache(CullCache::create());
+
+        int numMismatches = 0;
+        for (uint64_t frame = 0; frame < 50; ++frame)
+        {
+            for (int v = 0; v < 2; ++v)
+            {
+                if (!compare(*scene, uncached, cached, frame, projection, viewAt(0.01 * static_cast<double>(frame) + v * 2.0, 50.0 * v))) ++numMismatches;
+            }
+        }
+        VSG_CHECK(numMismatches == 0);
+    }
+
+    // a scene graph modification discards the previous results, so a node allocated at the address of a removed node can't match a stale result
+    {
+        auto cache = CullCache::create();
+        std::vector<dplane> polytope{dplane(1.0, 0.0, 0.0, 0.0)};
+        dmat4 projectionMatrix, viewMatrix;
+        Node* node = scene.get();
+        int numTraversed = 0;
+        auto frame = [&](uint64_t sceneGraphModifiedCount, double x) {
+            cache->beginView(nullptr, projectionMatrix, viewMatrix, sceneGraphModifiedCount);
+            bool reused = cache->reuse();
+            cache->cull(node, polytope, dsphere(x, 0.0, 0.0, 1.0), []() -> uint16_t { return 1; }, [&](uint16_t) { ++numTraversed; });
+            return reused;
+        };
+
+        frame(0, -10.0);
+        VSG_CHECK(frame(0, 10.0) && numTraversed == 0);
+        VSG_CHECK(!frame(1, 10.0) && numTraversed == 1);
+    }
+
+    return vsg_test::result();
+}
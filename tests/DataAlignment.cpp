@@ -0,0 +1,176 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2020 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/core/Array.h>
+#include <vsg/core/Array2D.h>
+#include <vsg/core/Array3D.h>
+#include <vsg/core/ArenaAllocator.h>
+#include <vsg/io/Options.h>
+#include <vsg/io/ReaderWriter_vsg.h>
+#include <vsg/maths/mat4.h>
+
+#include "check.h"
+
+#include <cstdio>
+#include <cstring>
+#include <type_traits>
+
+using namespace vsg;
+
+static bool aligned(const void* ptr, std::size_t alignment)
+{
+    return (reinterpret_cast<uintptr_t>(ptr) % alignment) == 0;
+}
+
+static Data::Layout alignedLayout(uint8_t alignment)
+{
+    Data::Layout layout;
+    layout.alignment = alignment;
+    return layout;
+}
+
+// Array, Array2D and Array3D data must honour Layout::alignment, including alignments greater than new[] provides
+static void testAllocation()
+{
+    for (uint8_t alignment : {16, 32, 64})
+    {
+        for (int i = 0; i < 8; ++i)
+        {
+            auto array = floatArray::create(13 + i, alignedLayout(alignment));
+            auto array2D = vec4Array2D::create(3 + i, 5, alignedLayout(alignment));
+            auto array3D = ubvec4Array3D::create(3, 2 + i, 7, alignedLayout(alignment));
+
+            VSG_CHECK(aligned(array->dataPointer(), alignment));
+            VSG_CHECK(aligned(array2D->dataPointer(), alignment));
+            VSG_CHECK(aligned(array3D->dataPointer(), alignment));
+            VSG_CHECK(array->getLayout().alignment == alignment);
+        }
+    }
+}
+
+// fills each allocation with 0xff so values that aren't constructed are detected
+class FilledArenaAllocator : public ArenaAllocator
+{
+public:
+    void* allocate(std::size_t size) override
+    {
+        void* ptr = ArenaAllocator::allocate(size);
+        if (ptr) std::memset(ptr, 0xff, size);
+        return ptr;
+    }
+};
+
+// trivially copyable so allocated from the Allocator, but with a default constructor that must still be run
+struct Zeroed
+{
+    Zeroed() :
+        value{1.0f, 2.0f, 3.0f} {}
+
+    float value[3];
+};
+
+// exposes Data::_allocateValues() to allocate from the Allocator the Data was created with, as BinaryInput does with Options::arenaAllocation
+class AllocationProbe : public Inherit<floatArray, AllocationProbe>
+{
+public:
+    template<typename T>
+    bool allocatesFromAllocator(const T& expected)
+    {
+        const std::size_t numValues = 9;
+        T* values = _allocateValues<T>(numValues);
+        bool fromAllocator = _dataAllocation == ALLOCATOR_ALLOCATION;
+
+        bool defaultValues = true;
+        for (std::size_t i = 0; i < numValues; ++i)
+        {
+            if (std::memcmp(&values[i], &expected, sizeof(T)) != 0) defaultValues = false;
+        }
+
+        _deallocateValues(values);
+        return fromAllocator && defaultValues;
+    }
+};
+
+// values allocated from an Allocator must be default constructed when their type isn't trivially default constructible
+static void testAllocatorConstruction()
+{
+    static_assert(std::is_trivially_copyable_v<Zeroed> && !std::is_trivially_default_constructible_v<Zeroed>);
+
+    ref_ptr<Allocator> allocator(new FilledArenaAllocator());
+    auto probe = allocator->createObject<AllocationProbe>();
+
+    VSG_CHECK(probe->getAllocator() == allocator.get());
+    VSG_CHECK(probe->allocatesFromAllocator(Zeroed()));
+
+    // trivially default constructible values are left as allocated
+    uint32_t filled = 0xffffffff;
+    VSG_CHECK(probe->allocatesFromAllocator(filled));
+}
+
+template<class T>
+static ref_ptr<T> roundTrip(const T* data, const std::string& version = {})
+{
+    auto options = Options::create();
+    if (!version.empty()) options->setValue("version", version);
+
+    const Path filename = "DataAlignment_test.vsgb";
+    auto readerWriter = ReaderWriter_vsg::create();
+    VSG_CHECK(readerWriter->write(data, filename, options));
+    auto object = readerWriter->read(filename);
+    std::remove(filename.c_str());
+    return object.cast<T>();
+}
+
+// 0.0.3 files record Layout::alignment so data read back is allocated with the same alignment, 0.0.2 files without it are still read with the default alignment
+static void testReadWrite()
+{
+    auto array = vec4Array::create(37, alignedLayout(64));
+    for (std::size_t i = 0; i < array->size(); ++i) array->at(i) = vec4(float(i), 1.0f, 2.0f, 3.0f);
+
+    auto array3D = floatArray3D::create(4, 5, 6, alignedLayout(32));
+    for (std::size_t i = 0; i < array3D->valueCount(); ++i) array3D->data()[i] = float(i) * 0.5f;
+
+    auto copy = roundTrip(array.get());
+    VSG_CHECK(copy.valid());
+    if (copy)
+    {
+        VSG_CHECK(copy->getLayout().alignment == 64);
+        VSG_CHECK(aligned(copy->dataPointer(), 64));
+        VSG_CHECK(copy->dataSize() == array->dataSize() && std::memcmp(copy->dataPointer(), array->dataPointer(), array->dataSize()) == 0);
+    }
+
+    auto copy3D = roundTrip(array3D.get());
+    VSG_CHECK(copy3D.valid());
+    if (copy3D)
+    {
+        VSG_CHECK(copy3D->getLayout().alignment == 32);
+        VSG_CHECK(aligned(copy3D->dataPointer(), 32));
+        VSG_CHECK(copy3D->dataSize() == array3D->dataSize() && std::memcmp(copy3D->dataPointer(), array3D->dataPointer(), array3D->dataSize()) == 0);
+    }
+
+    auto previous = roundTrip(array.get(), "0.0.2");
+    VSG_CHECK(previous.valid());
+    if (previous)
+    {
+        VSG_CHECK(previous->getLayout().alignment == 0);
+        VSG_CHECK(previous->size() == array->size());
+        VSG_CHECK(previous->dataSize() == array->dataSize() && std::memcmp(previous->dataPointer(), array->dataPointer(), array->dataSize()) == 0);
+    }
+}
+
+int main()
+{
+    testAllocation();
+    testAllocatorConstruction();
+    testReadWrite();
+    return vsg_test::result();
+}
@@ -0,0 +1,182 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2020 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/io/DatabasePager.h>
+
+#include "check.h"
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+using namespace vsg;
+
+static ref_ptr<PagedLOD> createPagedLOD(double priority)
+{
+    auto plod = PagedLOD::create();
+    plod->priority = priority;
+    return plod;
+}
+
+// take() must return the PagedLOD in descending priority order, whatever order they were added in
+static void testPopOrder()
+{
+    auto queue = DatabaseQueue::create(ActivityStatus::create());
+
+    std::mt19937 rng(1);
+    std::uniform_real_distribution<double> u(0.0, 100.0);
+    std::vector<double> priorities;
+    for (int i = 0; i < 1000; ++i)
+    {
+        priorities.push_back(u(rng));
+        if (i % 10 == 0) priorities.push_back(priorities.back()); // equal priorities
+    }
+
+    DatabaseQueue::Nodes nodes;
+    for (auto priority : priorities) nodes.push_back(createPagedLOD(priority));
+
+    // add individually and as a batch
+    for (std::size_t i = 0; i < nodes.size() / 2; ++i) queue->add(nodes[i]);
+    DatabaseQueue::Nodes remaining(nodes.begin() + nodes.size() / 2, nodes.end());
+    queue->add(remaining);
+    VSG_CHECK(queue->size() == priorities.size());
+
+    std::sort(priorities.begin(), priorities.end(), std::greater<double>());
+    std::size_t numOutOfOrder = 0;
+    for (auto priority : priorities)
+    {
+        auto plod = queue->take();
+        if (!plod || plod->priority.load() != priority) ++numOutOfOrder;
+    }
+    VSG_CHECK(numOutOfOrder == 0);
+    VSG_CHECK(queue->size() == 0);
+    VSG_CHECK(!queue->take());
+}
+
+// updatePriority() must move a PagedLOD whose priority has increased up the heap in place
+static void testUpdatePriority()
+{
+    auto queue = DatabaseQueue::create(ActivityStatus::create());
+
+    std::mt19937 rng(2);
+    std::uniform_real_distribution<double> u(0.0, 100.0);
+    DatabaseQueue::Nodes nodes;
+    for (int i = 0; i < 500; ++i)
+    {
+        nodes.push_back(createPagedLOD(u(rng)));
+        queue->add(nodes.back());
+    }
+
+    // raise the priority of random entries, including ones already near the top, as RecordTraversal does each frame
+    for (int i = 0; i < 200; ++i)
+    {
+        auto& plod = nodes[rng() % nodes.size()];
+        plod->priority = plod->priority.load() + u(rng);
+        queue->updatePriority(plod);
+    }
+
+    // the lowest priority entry raised above all the others must be taken first
+    auto lowest = *std::min_element(nodes.begin(), nodes.end(), [](const ref_ptr<PagedLOD>& lhs, const ref_ptr<PagedLOD>& rhs) { return lhs->priority.load() < rhs->priority.load(); });
+    lowest->priority = 1000.0;
+    queue->updatePriority(lowest);
+
+    // a PagedLOD not in the queue is ignored, even if its queueIndex matches a queued entry
+    auto other = createPagedLOD(2000.0);
+    queue->updatePriority(other);
+
+    VSG_CHECK(queue->take() == lowest);
+
+    // decreases aren't applied, so the queue holds each entry at the highest priority it was updated with
+    nodes[0]->priority = -1.0;
+    queue->updatePriority(nodes[0]);
+
+    double previous = 1000.0;
+    std::size_t numOutOfOrder = 0;
+    std::size_t numTaken = 1;
+    while (auto plod = queue->take())
+    {
+        double priority = plod == nodes[0] ? previous : plod->priority.load();
+        if (priority > previous) ++numOutOfOrder;
+        previous = priority;
+        ++numTaken;
+    }
+    VSG_CHECK(numOutOfOrder == 0);
+    VSG_CHECK(numTaken == nodes.size());
+}
+
+// take_stale() removes entries from the middle of the heap, the remaining entries must still be taken in priority order
+static void testRemoval()
+{
+    auto queue = DatabaseQueue::create(ActivityStatus::create());
+
+    std::mt19937 rng(3);
+    std::uniform_real_distribution<double> u(0.0, 100.0);
+    const uint64_t frameCount = 100;
+    for (int i = 0; i < 300; ++i)
+    {
+        auto plod = createPagedLOD(u(rng));
+        plod->frameHighResLastUsed = (i % 3 == 0) ? frameCount - 10 : frameCount;
+        queue->add(plod);
+    }
+
+    auto stale = queue->take_stale(frameCount);
+    VSG_CHECK(stale.size() == 100);
+    VSG_CHECK(queue->size() == 200);
+
+    // entries must remain updatable after being moved by the removal
+    auto top = createPagedLOD(0.0);
+    queue->add(top);
+    top->priority = 500.0;
+    queue->updatePriority(top);
+    VSG_CHECK(queue->take() == top);
+
+    double previous = 1000.0;
+    std::size_t numOutOfOrder = 0;
+    while (auto plod = queue->take())
+    {
+        if (plod->priority.load() > previous) ++numOutOfOrder;
+        previous = plod->priority.load();
+    }
+    VSG_CHECK(numOutOfOrder == 0);
+}
+
+// take_share_when_available() takes the highest priority share of the queue so that a burst of requests is spread across the compile threads
+static void testTakeShare()
+{
+    auto queue = DatabaseQueue::create(ActivityStatus::create());
+
+    for (int i = 0; i < 10; ++i)
+    {
+        queue->add(createPagedLOD(double(i)));
+    }
+
+    auto nodes = queue->take_share_when_available(4);
+    VSG_CHECK(nodes.size() == 3);
+    VSG_CHECK(nodes.size() == 3 && nodes[0]->priority.load() == 9.0 && nodes[2]->priority.load() == 7.0);
+    VSG_CHECK(queue->size() == 7);
+
+    VSG_CHECK(queue->take_share_when_available(2, 2).size() == 2);
+    VSG_CHECK(queue->take_share_when_available(8).size() == 1);
+
+    nodes = queue->take_share_when_available(1);
+    VSG_CHECK(nodes.size() == 4);
+    VSG_CHECK(queue->size() == 0);
+}
+
+int main()
+{
+    testPopOrder();
+    testUpdatePriority();
+    testRemoval();
+    testTakeShare();
+    return vsg_test::result();
+}
@@ -0,0 +1,190 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2020 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+
+#include <vsg/core/Array.h>
+#include <vsg/core/Objects.h>
+#include <vsg/core/Value.h>
+#include <vsg/core/Version.h>
+#include <vsg/io/BinaryInput.h>
+#include <vsg/io/BinaryOutput.h>
+#include <vsg/io/ObjectFactory.h>
+#include <vsg/io/Options.h>
+#include <vsg/io/ReaderWriter_vsg.h>
+#include <vsg/nodes/Group.h>
+#include <vsg/nodes/MatrixTransform.h>
+
+#include "check.h"
+
+#include <cstdio>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace vsg;
+
+static ref_ptr<Objects> createObjects()
+{
+    // repeated classes so that later objects reference class names already in the table
+    auto objects = Objects::create();
+    for (int i = 0; i < 5; ++i)
+    {
+        auto group = Group::create();
+        group->addChild(MatrixTransform::create());
+        group->addChild(Group::create());
+        objects->addChild(group);
+        objects->addChild(intValue::create(i));
+        objects->addChild(vec3Array::create(i + 1));
+        objects->addChild(ref_ptr<Object>());
+    }
+    objects->addChild(stringValue::create("last"));
+    return objects;
+}
+
+static void collectClassNames(const Object* object, std::vector<std::string>& classNames)
+{
+    classNames.push_back(object ? object->className() : "nullptr");
+    if (auto objects = dynamic_cast<const Objects*>(object))
+    {
+        for (auto& child : objects->getChildren()) collectClassNames(child, classNames);
+    }
+    else if (auto group = dynamic_cast<const Group*>(object))
+    {
+        for (auto& child : group->getChildren()) collectClassNames(child, classNames);
+    }
+}
+
+static std::vector<std::string> classNames(const Object* object)
+{
+    std::vector<std::string> names;
+    collectClassNames(object, names);
+    return names;
+}
+
+static ref_ptr<Object> roundTrip(const Object* object, const std::string& version = {})
+{
+    auto options = Options::create();
+    if (!version.empty()) options->setValue("version", version);
+
+    const Path filename = "ObjectFactory_test.vsgb";
+    auto readerWriter = ReaderWriter_vsg::create();
+    VSG_CHECK(readerWriter->write(object, filename, options));
+    auto copy = readerWriter->read(filename);
+    std::remove(filename.c_str());
+    return copy;
+}
+
+// 0.0.2 and later files write each class name once and then refer to it by index, 0.0.1 files without the table write every class name in full and must still be read
+static void testClassNameTable()
+{
+    auto objects = createObjects();
+    auto expected = classNames(objects);
+
+    for (auto version : {std::string(), std::string("0.0.2"), std::string("0.0.1")})
+    {
+        auto copy = roundTrip(objects, version);
+        VSG_CHECK(copy.valid());
+        VSG_CHECK(classNames(copy) == expected);
+
+        auto copiedObjects = copy.cast<Objects>();
+        auto value = copiedObjects ? dynamic_cast<const intValue*>(copiedObjects->getChildren()[5].get()) : nullptr;
+        VSG_CHECK(value && value->value() == 1);
+    }
+}
+
+class PatchedGroup : public Inherit<Group, PatchedGroup>
+{
+};
+
+// entries replaced through getCreateMap() and getCreateWithAllocatorMap() must be used by create(const InternedString&, ..) as well as by the string lookup
+static void testPatchedCreateMap()
+{
+    ref_ptr<ObjectFactory> objectFactory(new ObjectFactory);
+
+    InternedString groupName("vsg::Group");
+    VSG_CHECK(objectFactory->create(groupName).cast<PatchedGroup>() == nullptr);
+
+    objectFactory->getCreateMap()["vsg::Group"] = []() { return ref_ptr<Object>(PatchedGroup::create()); };
+    objectFactory->getCreateWithAllocatorMap().erase("vsg::Group");
+
+    VSG_CHECK(objectFactory->create(std::string("vsg::Group")).cast<PatchedGroup>() != nullptr);
+    VSG_CHECK(objectFactory->create(groupName).cast<PatchedGroup>() != nullptr);
+
+    // a class only added to the map is found by its interned name
+    objectFactory->getCreateMap()["test::Patched"] = []() { return ref_ptr<Object>(PatchedGroup::create()); };
+    VSG_CHECK(objectFactory->create(InternedString("test::Patched")).cast<PatchedGroup>() != nullptr);
+
+    // removed classes can no longer be created
+    objectFactory->getCreateMap().erase("vsg::Group");
+    VSG_CHECK(!objectFactory->create(groupName));
+
+    // objects read with the factory use the patched entries
+    objectFactory->getCreateMap()["vsg::Group"] = []() { return ref_ptr<Object>(PatchedGroup::create()); };
+
+    std::stringstream stream;
+    BinaryOutput output(stream);
+    output.version = vsgGetVersion();
+    output.writeObject("Root", createObjects());
+
+    BinaryInput input(stream, objectFactory, {});
+    input.version = output.version;
+    auto copy = input.readObject("Root").cast<Objects>();
+
+    VSG_CHECK(copy.valid());
+    if (copy) VSG_CHECK(copy->getChildren()[0].cast<PatchedGroup>() != nullptr);
+
+    // classes added through a map reference held from before the interned functions were last rebuilt are still found
+    auto& createMap = objectFactory->getCreateMap();
+    VSG_CHECK(objectFactory->create(groupName).cast<PatchedGroup>() != nullptr);
+    createMap["test::Held"] = []() { return ref_ptr<Object>(PatchedGroup::create()); };
+    VSG_CHECK(objectFactory->create(InternedString("test::Held")).cast<PatchedGroup>() != nullptr);
+}
+
+// subclasses overriding the virtual create(const std::string&) must be used for binary reads just as they are for ascii reads
+class OverridingObjectFactory : public ObjectFactory
+{
+public:
+    vsg::ref_ptr<vsg::Object> create(const std::string& className) override
+    {
+        if (className == "vsg::Group") return PatchedGroup::create();
+        return ObjectFactory::create(className);
+    }
+
+    using ObjectFactory::create;
+};
+
+static void testOverridingObjectFactory()
+{
+    ref_ptr<ObjectFactory> objectFactory(new OverridingObjectFactory);
+    VSG_CHECK(objectFactory->create(InternedString("vsg::Group")).cast<PatchedGroup>() != nullptr);
+    VSG_CHECK(objectFactory->create(InternedString("vsg::MatrixTransform")).cast<MatrixTransform>() != nullptr);
+
+    std::stringstream stream;
+    BinaryOutput output(stream);
+    output.version = vsgGetVersion();
+    output.writeObject("Root", createObjects());
+
+    BinaryInput input(stream, objectFactory, {});
+    input.version = output.version;
+    auto copy = input.readObject("Root").cast<Objects>();
+
+    VSG_CHECK(copy.valid());
+    if (copy) VSG_CHECK(copy->getChildren()[0].cast<PatchedGroup>() != nullptr);
+}
+
+int main()
+{
+    testClassNameTable();
+    testPatchedCreateMap();
+    testOverridingObjectFactory();
+    return vsg_test::result();
+}
@@ -0,0 +1,123 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2020 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/core/Auxiliary.h>
+#include <vsg/core/Value.h>
+#include <vsg/io/AsciiOutput.h>
+
+#include "check.h"
+
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace vsg;
+
+static void testValues()
+{
+    ref_ptr<Object> object(new Object);
+
+    // enough entries to spill over from the inline storage
+    for (int i = 0; i < 10; ++i) object->setValue("key" + std::to_string(i), i);
+    for (int i = 0; i < 10; ++i)
+    {
+        int value = -1;
+        VSG_CHECK(object->getValue("key" + std::to_string(i), value) && value == i);
+    }
+
+    int value = 0;
+    VSG_CHECK(!object->getValue("unknown", value));
+    VSG_CHECK(!object->getValue(InternedString::find("never used as a key"), value));
+
+    object->setValue("", 42);
+    VSG_CHECK(object->getValue("", value) && value == 42);
+
+    // setting an existing value updates it in place unless it's referenced elsewhere
+    auto before = object->getObject("key3");
+    object->setValue("key3", 33);
+    VSG_CHECK(object->getObject("key3") == before);
+
+    ref_ptr<Object> held(object->getObject("key4"));
+    object->setValue("key4", 44);
+    VSG_CHECK(object->getObject("key4") != held.get());
+    VSG_CHECK(object->getValue("key4", value) && value == 44);
+
+    for (int i = 0; i < 10; i += 2) object->removeObject("key" + std::to_string(i));
+    VSG_CHECK(object->getAuxiliary()->getObjectMap().size() == 6);
+    VSG_CHECK(object->getValue("key3", value) && value == 33);
+
+    ref_ptr<Object> copy(new Object(*object));
+    VSG_CHECK(copy->getValue("key5", value) && value == 5);
+
+    object->setValue("string", std::string("text"));
+    std::string text;
+    VSG_CHECK(object->getValue("string", text) && text == "text");
+}
+
+static void testInternedStrings()
+{
+    InternedString a("key"), b(std::string("key")), c("other");
+    VSG_CHECK(a == b);
+    VSG_CHECK(a != c);
+    VSG_CHECK(a.str() == "key");
+
+    // concurrent interning of the same strings must produce the same handles
+    std::vector<std::thread> threads;
+    std::vector<int> numMismatches(4, 0);
+    for (std::size_t t = 0; t < numMismatches.size(); ++t)
+    {
+        threads.emplace_back([&numMismatches, t] {
+            for (int i = 0; i < 1000; ++i)
+            {
+                auto str = "key" + std::to_string(i);
+                InternedString interned(str);
+                if (interned.str() != str || InternedString::find(str) != interned) ++numMismatches[t];
+            }
+        });
+    }
+    for (auto& thread : threads) thread.join();
+    for (auto count : numMismatches) VSG_CHECK(count == 0);
+}
+
+static std::string writeToString(const Object* object)
+{
+    std::ostringstream str;
+    AsciiOutput output(str);
+    output.writeObject("Root", object);
+    return str.str();
+}
+
+static void testDeterministicWrite()
+{
+    // the same meta data set in different orders must be written out identically
+    ref_ptr<Object> forward(new Object);
+    ref_ptr<Object> backward(new Object);
+    for (int i = 0; i < 6; ++i) forward->setValue("write" + std::to_string(i), i);
+    for (int i = 5; i >= 0; --i) backward->setValue("write" + std::to_string(i), i);
+
+    // erase() moves the last entry into the removed slot, changing the order further
+    forward->setValue("removed", 0);
+    forward->removeObject("removed");
+
+    auto forwardText = writeToString(forward);
+    VSG_CHECK(forwardText == writeToString(backward));
+    VSG_CHECK(forwardText.find("write0") < forwardText.find("write5"));
+}
+
+int main()
+{
+    testValues();
+    testInternedStrings();
+    testDeterministicWrite();
+    return vsg_test::result();
+}
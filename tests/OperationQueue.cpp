@@ -0,0 +1,183 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2020 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/threading/OperationQueue.h>
+#include <vsg/threading/OperationThreads.h>
+
+#include "check.h"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+using namespace vsg;
+
+struct Record : public Inherit<Operation, Record>
+{
+    explicit Record(int in_value) :
+        value(in_value) {}
+
+    void run() override {}
+
+    int value;
+};
+
+static int valueOf(const ref_ptr<Operation>& operation)
+{
+    auto record = operation.cast<Record>();
+    return record ? record->value : -1;
+}
+
+static void testRingFullAndWrapAround()
+{
+    // requested capacities are rounded up to a power of two
+    RingQueue<int> ring(3);
+    VSG_CHECK(ring.capacity() == 4);
+
+    int value = 0;
+    VSG_CHECK(!ring.pop(value));
+
+    for (int i = 0; i < 4; ++i) VSG_CHECK(ring.push(i));
+    VSG_CHECK(ring.size() == 4);
+    VSG_CHECK(!ring.push(4));
+
+    // cycle values through the ring many times over so the positions wrap past the end of the cells
+    int expected = 0;
+    int next = 4;
+    for (int i = 0; i < 100; ++i)
+    {
+        VSG_CHECK(ring.pop(value) && value == expected);
+        ++expected;
+        VSG_CHECK(ring.push(next++));
+        VSG_CHECK(!ring.push(-1));
+    }
+
+    while (ring.pop(value))
+    {
+        VSG_CHECK(value == expected);
+        ++expected;
+    }
+    VSG_CHECK(expected == next);
+    VSG_CHECK(ring.size() == 0);
+}
+
+static void testOverflow()
+{
+    // with a capacity of 4 the later operations spill into the overflow list
+    auto queue = OperationQueue::create(ActivityStatus::create(), 4);
+    for (int i = 0; i < 10; ++i) queue->add(Record::create(i));
+    VSG_CHECK(!queue->empty());
+
+    // operations added while the overflow list isn't empty go to the overflow list even once there is room in the ring, so FIFO order is kept
+    VSG_CHECK(valueOf(queue->take()) == 0);
+    VSG_CHECK(valueOf(queue->take()) == 1);
+    queue->add(Record::create(10));
+
+    for (int i = 2; i <= 10; ++i) VSG_CHECK(valueOf(queue->take()) == i);
+    VSG_CHECK(!queue->take());
+    VSG_CHECK(queue->empty());
+
+    // once drained new operations go back into the ring
+    queue->add(Record::create(11));
+    VSG_CHECK(valueOf(queue->take()) == 11);
+    VSG_CHECK(queue->empty());
+}
+
+static void testConcurrentOverflow()
+{
+    // producers overrunning a small ring while consumers drain it, every operation must be taken exactly once
+    constexpr int numProducers = 4;
+    constexpr int numConsumers = 4;
+    constexpr int numPerProducer = 20000;
+
+    auto status = ActivityStatus::create();
+    auto queue = OperationQueue::create(status, 16);
+
+    std::vector<std::atomic_int> taken(numProducers * numPerProducer);
+    for (auto& count : taken) count = 0;
+    std::atomic_int numTaken{0};
+
+    std::vector<std::thread> threads;
+    for (int c = 0; c < numConsumers; ++c)
+    {
+        threads.emplace_back([&]() {
+            while (auto operation = queue->take_when_avilable())
+            {
+                ++taken[valueOf(operation)];
+                if (++numTaken == numProducers * numPerProducer)
+                {
+                    status->set(false);
+                    queue->release();
+                }
+            }
+        });
+    }
+
+    for (int p = 0; p < numProducers; ++p)
+    {
+        threads.emplace_back([&, p]() {
+            for (int i = 0; i < numPerProducer; ++i) queue->add(Record::create(p * numPerProducer + i));
+        });
+    }
+
+    for (auto& thread : threads) thread.join();
+
+    int numWrong = 0;
+    for (auto& count : taken)
+    {
+        if (count != 1) ++numWrong;
+    }
+    VSG_CHECK(numWrong == 0);
+    VSG_CHECK(queue->empty());
+}
+
+struct Count : public Inherit<Operation, Count>
+{
+    explicit Count(std::atomic_int& in_count) :
+        count(in_count) {}
+
+    void run() override { ++count; }
+
+    std::atomic_int& count;
+};
+
+// operations added directly to OperationThreads::queue must wake the pool's parked threads, as those added with OperationThreads::add() do
+static void testOperationThreadsQueue()
+{
+    auto operationThreads = OperationThreads::create(2);
+
+    std::atomic_int count{0};
+    for (int i = 0; i < 10; ++i)
+    {
+        // give the threads time to park before each addition
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        operationThreads->queue->add(Count::create(count));
+
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        while (count.load() <= i && std::chrono::steady_clock::now() < deadline) std::this_thread::yield();
+        VSG_CHECK(count.load() == i + 1);
+    }
+
+    operationThreads->stop();
+    VSG_CHECK(count.load() == 10);
+}
+
+int main()
+{
+    testRingFullAndWrapAround();
+    testOverflow();
+    testConcurrentOverflow();
+    testOperationThreadsQueue();
+
+    return vsg_test::result();
+}
@@ -0,0 +1,99 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2020 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/maths/transform.h>
+#include <vsg/nodes/CullGroup.h>
+#include <vsg/nodes/CullNode.h>
+#include <vsg/nodes/Group.h>
+#include <vsg/traversals/RecordTraversal.h>
+#include <vsg/vk/State.h>
+
+#include "check.h"
+
+#include <functional>
+#include <random>
+#include <vector>
+
+using namespace vsg;
+
+static std::vector<int> s_visited;
+
+class Leaf : public Inherit<Node, Leaf>
+{
+public:
+    explicit Leaf(int in_id) :
+        id(in_id) {}
+
+    int id;
+
+    void traverse(RecordTraversal&) const override { s_visited.push_back(id); }
+};
+
+// a RecordTraversal over a random scene of CullNodes and CullGroups, which groups with several children batch test, must visit the same nodes in the same order as culling each node individually
+int main()
+{
+    RecordTraversal recordTraversal;
+    recordTraversal.setProjectionAndViewMatrix(perspective(1.0, 1.5, 1.0, 1000.0), lookAt(dvec3(0.0, 0.0, 0.0), dvec3(1.0, 0.2, 0.0), dvec3(0.0, 0.0, 1.0)));
+    auto& polytope = recordTraversal.getState()->_frustumStack.top();
+
+    std::mt19937 rng(5);
+    std::uniform_real_distribution<double> u(-500.0, 500.0), r(0.0, 50.0);
+    std::vector<int> expected;
+    int numLeaves = 0;
+
+    std::function<ref_ptr<Group>(int)> build = [&](int depth) {
+        auto group = Group::create();
+        int numChildren = 1 + (rng() % 70);
+        for (int i = 0; i < numChildren; ++i)
+        {
+            dsphere bound(dvec3(u(rng), u(rng), u(rng) * 0.2), r(rng));
+            bool visible = intersect(polytope, bound);
+            switch (rng() % 4)
+            {
+            case 0:
+                group->addChild(Leaf::create(numLeaves));
+                expected.push_back(numLeaves++);
+                break;
+            case 1:
+                group->addChild(CullNode::create(bound, Leaf::create(numLeaves)));
+                if (visible) expected.push_back(numLeaves);
+                ++numLeaves;
+                break;
+            case 2: {
+                auto cullGroup = CullGroup::create(bound);
+                int numCullGroupChildren = rng() % 10;
+                for (int j = 0; j < numCullGroupChildren; ++j)
+                {
+                    dsphere childBound(dvec3(u(rng), u(rng), u(rng) * 0.2), r(rng));
+                    cullGroup->addChild(CullNode::create(childBound, Leaf::create(numLeaves)));
+                    if (visible && intersect(polytope, childBound)) expected.push_back(numLeaves);
+                    ++numLeaves;
+                }
+                group->addChild(cullGroup);
+                break;
+            }
+            default:
+                if (depth < 3) group->addChild(build(depth + 1));
+                break;
+            }
+        }
+        return group;
+    };
+
+    auto root = build(0);
+    root->accept(recordTraversal);
+
+    VSG_CHECK(!expected.empty() && expected.size() < static_cast<std::size_t>(numLeaves));
+    VSG_CHECK(s_visited == expected);
+
+    return vsg_test::result();
+}
@@ -0,0 +1,99 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2020 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/nodes/Group.h>
+
+#include "check.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace vsg;
+
+static std::atomic_int s_numDeleted{0};
+
+class Counted : public Inherit<Node, Counted>
+{
+protected:
+    ~Counted() { ++s_numDeleted; }
+};
+
+static void testRefUnref()
+{
+    s_numDeleted = 0;
+
+    auto object = new Counted;
+    object->ref();
+    object->ref();
+    VSG_CHECK(object->referenceCount() == 2);
+
+    object->unref_nodelete();
+    VSG_CHECK(object->referenceCount() == 1);
+    VSG_CHECK(s_numDeleted == 0);
+
+    object->unref();
+    VSG_CHECK(s_numDeleted == 1);
+}
+
+// copy each child's ref_ptr, returning the number of copies that didn't see the reference already held by the group
+static int copyChildren(const Group& group)
+{
+    int numIncorrect = 0;
+    for (auto& child : group.getChildren())
+    {
+        ref_ptr<Node> copy(child);
+        if (!copy || copy->referenceCount() < 2) ++numIncorrect;
+    }
+    return numIncorrect;
+}
+
+static void testHandoff()
+{
+    s_numDeleted = 0;
+
+    // build a subgraph holding extra references on the constructing thread, then release them and hand the subgraph off to other threads, the relaxed increments and acq_rel decrements must still delete each child exactly once
+    constexpr int numChildren = 10000;
+    auto root = Group::create();
+    std::vector<Node*> held;
+    for (int i = 0; i < numChildren; ++i)
+    {
+        auto child = Counted::create();
+        child->ref();
+        held.push_back(child.get());
+        root->addChild(child);
+    }
+    for (auto node : held) node->unref();
+    VSG_CHECK(s_numDeleted == 0);
+
+    std::vector<std::thread> threads;
+    std::atomic_int numIncorrect{0};
+    for (int t = 0; t < 4; ++t)
+    {
+        threads.emplace_back([root, &numIncorrect]() { numIncorrect += copyChildren(*root); });
+    }
+    for (auto& thread : threads) thread.join();
+    VSG_CHECK(numIncorrect == 0);
+
+    std::thread([r = root]() mutable { r = {}; }).join();
+    VSG_CHECK(s_numDeleted == 0);
+
+    root = {};
+    VSG_CHECK(s_numDeleted == numChildren);
+}
+
+int main()
+{
+    testRefUnref();
+    testHandoff();
+    return vsg_test::result();
+}
@@ -0,0 +1,107 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2020 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/core/SlabAllocator.h>
+#include <vsg/nodes/Group.h>
+
+#include "check.h"
+
+#include <cstring>
+#include <thread>
+#include <vector>
+
+using namespace vsg;
+
+static void testBlocks()
+{
+    ref_ptr<SlabAllocator> allocator(new SlabAllocator(5000, 1));
+    VSG_CHECK((allocator->slabSize & (allocator->slabSize - 1)) == 0);
+
+    // blocks deallocated without a size are returned to their slab's free list rather than the global heap
+    void* first = allocator->allocate(40);
+    allocator->deallocate(first, 0);
+    void* second = allocator->allocate(40);
+    VSG_CHECK(first == second);
+
+    // blocks deallocated with the wrong size are returned to the size class recorded by their slab
+    allocator->deallocate(second, 100);
+    void* third = allocator->allocate(40);
+    VSG_CHECK(third == second);
+    void* other = allocator->allocate(100);
+    VSG_CHECK(other != third);
+
+    // large and zero sized allocations
+    allocator->deallocate(allocator->allocate(5000), 0);
+    allocator->deallocate(allocator->allocate(0), 0);
+
+    // many blocks of mixed sizes must be aligned and not overlap
+    std::vector<std::pair<unsigned char*, std::size_t>> blocks;
+    for (std::size_t i = 0; i < 20000; ++i)
+    {
+        std::size_t size = 1 + (i * 37) % 1024;
+        auto block = static_cast<unsigned char*>(allocator->allocate(size));
+        VSG_CHECK((reinterpret_cast<uintptr_t>(block) % SlabAllocator::alignment) == 0);
+        std::memset(block, static_cast<int>(i & 0xff), size);
+        blocks.emplace_back(block, size);
+    }
+
+    std::size_t numOverwritten = 0;
+    for (std::size_t i = 0; i < blocks.size(); ++i)
+    {
+        for (std::size_t j = 0; j < blocks[i].second; ++j)
+        {
+            if (blocks[i].first[j] != (i & 0xff)) ++numOverwritten;
+        }
+    }
+    VSG_CHECK(numOverwritten == 0);
+
+    for (auto& [block, size] : blocks) allocator->deallocate(block, (size % 3 == 0) ? 0 : size);
+    allocator->deallocate(third, 40);
+    allocator->deallocate(other, 100);
+}
+
+static void testTiles()
+{
+    // build tiles on several threads with an allocator per tile, churn them, then release them from another thread
+    for (int tile = 0; tile < 20; ++tile)
+    {
+        ref_ptr<Allocator> allocator(new SlabAllocator(4096, 4));
+        auto root = Group::create(allocator);
+
+        std::vector<ref_ptr<Group>> branches(4);
+        std::vector<std::thread> threads;
+        for (std::size_t t = 0; t < branches.size(); ++t)
+        {
+            threads.emplace_back([&, t] {
+                auto branch = Group::create(allocator);
+                for (int i = 0; i < 5000; ++i) branch->addChild(Group::create(allocator));
+                for (int i = 0; i < 2000; ++i) branch->getChildren()[i] = Group::create(allocator);
+                branches[t] = branch;
+            });
+        }
+        for (auto& thread : threads) thread.join();
+
+        for (auto& branch : branches) root->addChild(branch);
+
+        std::thread([&] { branches.clear(); }).join();
+        root = nullptr;
+
+        VSG_CHECK(allocator->countAllocated() == allocator->countDeallocated());
+    }
+}
+
+int main()
+{
+    testBlocks();
+    testTiles();
+    return vsg_test::result();
+}
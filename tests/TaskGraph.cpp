@@ -0,0 +1,120 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2020 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/threading/TaskGraph.h>
+#include <vsg/threading/parallel_for.h>
+
+#include "check.h"
+
+#include <thread>
+#include <vector>
+
+using namespace vsg;
+
+// build a graph of layers of tasks where each task depends on every task in the previous layer, each task checks its dependencies completed before it started
+static void testDependencyOrder(OperationThreads* operationThreads)
+{
+    constexpr size_t numLayers = 8;
+    constexpr size_t tasksPerLayer = 16;
+
+    std::vector<std::atomic_bool> completed(numLayers * tasksPerLayer);
+    std::atomic_int numOutOfOrder{0};
+    std::atomic_int numRun{0};
+
+    auto taskGraph = TaskGraph::create();
+    std::vector<TaskGraph::Task*> tasks;
+    for (size_t layer = 0; layer < numLayers; ++layer)
+    {
+        for (size_t i = 0; i < tasksPerLayer; ++i)
+        {
+            size_t index = layer * tasksPerLayer + i;
+            auto task = taskGraph->add([&, layer, index]() {
+                if (layer > 0)
+                {
+                    for (size_t j = 0; j < tasksPerLayer; ++j)
+                    {
+                        if (!completed[(layer - 1) * tasksPerLayer + j]) ++numOutOfOrder;
+                    }
+                }
+                // give other threads a chance to run ahead if the dependencies weren't respected
+                std::this_thread::yield();
+                completed[index] = true;
+                ++numRun;
+            });
+
+            if (layer > 0)
+            {
+                for (size_t j = 0; j < tasksPerLayer; ++j) taskGraph->precede(tasks[(layer - 1) * tasksPerLayer + j], task);
+            }
+            tasks.push_back(task);
+        }
+    }
+
+    // a TaskGraph can be rerun, resetting the join counts each time
+    for (int run = 0; run < 3; ++run)
+    {
+        for (auto& flag : completed) flag = false;
+        numRun = 0;
+
+        VSG_CHECK(taskGraph->run(operationThreads));
+        VSG_CHECK(numRun == static_cast<int>(numLayers * tasksPerLayer));
+    }
+    VSG_CHECK(numOutOfOrder == 0);
+}
+
+static void testCycle()
+{
+    int numRun = 0;
+    auto taskGraph = TaskGraph::create();
+    auto a = taskGraph->add([&]() { ++numRun; });
+    auto b = taskGraph->add([&]() { ++numRun; });
+    auto c = taskGraph->add([&]() { ++numRun; });
+    taskGraph->precede(a, b);
+    taskGraph->precede(b, c);
+    taskGraph->precede(c, b);
+
+    VSG_CHECK(!taskGraph->run(nullptr));
+    VSG_CHECK(numRun == 0);
+}
+
+static void testParallelFor(OperationThreads* operationThreads)
+{
+    constexpr size_t numElements = 10007;
+    std::vector<std::atomic_int> visits(numElements);
+    for (auto& count : visits) count = 0;
+
+    parallel_for(operationThreads, 0, numElements, 64, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) ++visits[i];
+    });
+
+    int numWrong = 0;
+    for (auto& count : visits)
+    {
+        if (count != 1) ++numWrong;
+    }
+    VSG_CHECK(numWrong == 0);
+}
+
+int main()
+{
+    testCycle();
+
+    testDependencyOrder(nullptr);
+    testParallelFor(nullptr);
+
+    auto operationThreads = OperationThreads::create(4);
+    testDependencyOrder(operationThreads.get());
+    testParallelFor(operationThreads.get());
+    operationThreads->stop();
+
+    return vsg_test::result();
+}
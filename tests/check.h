@@ -0,0 +1,42 @@
+#pragma once
+
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2020 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+/// minimal test support, each test is a standalone program that reports the checks that fail and returns the number of failures from main() so ctest reports it as failed.
+
+#include <iostream>
+
+namespace vsg_test
+{
+    inline int numFailures = 0;
+
+    inline bool check(bool result, const char* expression, const char* file, int line)
+    {
+        if (!result)
+        {
+            std::cout << file << ":" << line << ": check failed: " << expression << std::endl;
+            ++numFailures;
+        }
+        return result;
+    }
+
+    inline int result()
+    {
+        if (numFailures == 0) std::cout << "passed" << std::endl;
+        else std::cout << numFailures << " checks failed" << std::endl;
+        return numFailures == 0 ? 0 : 1;
+    }
+} // namespace vsg_test
+
+/// check an expression, reporting the expression and location if it's false, unlike assert() it's also evaluated in release builds.
+#define VSG_CHECK(expression) vsg_test::check(static_cast<bool>(expression), #expression, __FILE__, __LINE__)
@@ -0,0 +1,70 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2020 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/maths/plane.h>
+#include <vsg/maths/transform.h>
+
+#include "check.h"
+
+#include <array>
+#include <random>
+#include <vector>
+
+using namespace vsg;
+
+// the batched intersect() must give exactly the same results as the scalar template for every sphere
+template<typename T>
+void testIntersect(std::size_t numPlanes)
+{
+    using plane_type = t_plane<T>;
+    using sphere_type = t_sphere<T>;
+
+    auto projection = perspective(T(1.0), T(1.5), T(1.0), T(1000.0)) * lookAt(t_vec3<T>(0, 0, 0), t_vec3<T>(1, 0.2, 0), t_vec3<T>(0, 0, 1));
+    std::array<plane_type, 6> clipPlanes{{plane_type(1, 0, 0, 1), plane_type(-1, 0, 0, 1), plane_type(0, 1, 0, 1), plane_type(0, -1, 0, 1), plane_type(0, 0, -1, 1), plane_type(0, 0, 1, 1)}};
+    std::vector<plane_type> planes;
+    for (std::size_t i = 0; i < numPlanes; ++i) planes.push_back(clipPlanes[i] * projection);
+
+    std::mt19937 rng(3);
+    std::uniform_real_distribution<double> u(-1500.0, 1500.0), r(0.0, 50.0);
+    const std::size_t numSpheres = 100000;
+    std::vector<sphere_type> spheres(numSpheres);
+    for (auto& s : spheres) s = sphere_type(t_vec3<T>(T(u(rng)), T(u(rng)), T(u(rng) * 0.1)), T(r(rng)));
+
+    // test counts that aren't a multiple of the SIMD width, checking the entries past the end aren't written
+    for (std::size_t count = numSpheres - 3; count <= numSpheres; ++count)
+    {
+        std::vector<uint8_t> visible(numSpheres + 1, 7);
+        std::size_t numVisible = intersect(planes.data(), planes.size(), spheres.data(), count, visible.data());
+
+        std::size_t numMismatches = 0, expectedNumVisible = 0;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            uint8_t expected = intersect(planes.begin(), planes.end(), spheres[i]) ? 1 : 0;
+            expectedNumVisible += expected;
+            if (visible[i] != expected) ++numMismatches;
+        }
+
+        VSG_CHECK(numMismatches == 0);
+        VSG_CHECK(numVisible == expectedNumVisible);
+        VSG_CHECK(visible[count] == 7);
+    }
+}
+
+int main()
+{
+    for (std::size_t numPlanes : {4u, 5u, 6u})
+    {
+        testIntersect<float>(numPlanes);
+        testIntersect<double>(numPlanes);
+    }
+    return vsg_test::result();
+}
@@ -0,0 +1,137 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2020 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/maths/transform.h>
+
+#include "check.h"
+
+#include <iostream>
+#include <random>
+#include <vector>
+
+using namespace vsg;
+
+// pack the modelview matrix and eye position as MatrixStack::record() does when relativeToEye is enabled
+static mat4 pack(const dmat4& matrix)
+{
+    auto eye = inverse_4x3(matrix)[3];
+
+    vec3 high, low;
+    split(dvec3(eye.x, eye.y, eye.z), high, low);
+
+    mat4 modelview(matrix);
+    modelview[3].set(high.x, high.y, high.z, 1.0f);
+    modelview[0][3] = low.x;
+    modelview[1][3] = low.y;
+    modelview[2][3] = low.z;
+    return modelview;
+}
+
+// emulate the float maths of the relative-to-eye vertex shader documented on MatrixStack::relativeToEye
+static vec3 shader(const mat4& packed, const vec3& inPositionHigh, const vec3& inPositionLow)
+{
+    vec3 eyeHigh(packed[3][0], packed[3][1], packed[3][2]);
+    vec3 eyeLow(packed[0][3], packed[1][3], packed[2][3]);
+    vec3 position = (inPositionHigh - eyeHigh) + (inPositionLow - eyeLow);
+
+    return vec3(packed[0][0] * position.x + packed[1][0] * position.y + packed[2][0] * position.z,
+                packed[0][1] * position.x + packed[1][1] * position.y + packed[2][1] * position.z,
+                packed[0][2] * position.x + packed[1][2] * position.y + packed[2][2] * position.z);
+}
+
+// split() must round the high part to the nearest float and keep the remainder in the low part
+static void testSplit()
+{
+    std::mt19937 rng(1);
+    std::uniform_real_distribution<double> u(-1.0, 1.0);
+
+    for (double magnitude : {1.0, 6.4e6, 3.844e8, 1.496e11})
+    {
+        std::vector<dvec3> in(1001);
+        for (auto& v : in) v.set(u(rng) * magnitude, u(rng) * magnitude, u(rng) * magnitude);
+
+        std::vector<vec3> high(in.size()), low(in.size());
+        split(in.data(), high.data(), low.data(), in.size());
+
+        std::size_t numNotRounded = 0;
+        std::size_t numMismatched = 0;
+        std::size_t numNonZeroLow = 0;
+        double maxRelativeError = 0.0;
+        for (std::size_t i = 0; i < in.size(); ++i)
+        {
+            for (int c = 0; c < 3; ++c)
+            {
+                if (double(high[i][c]) != double(float(in[i][c]))) ++numNotRounded;
+                if (low[i][c] != 0.0f) ++numNonZeroLow;
+                maxRelativeError = std::max(maxRelativeError, std::abs(double(high[i][c]) + double(low[i][c]) - in[i][c]) / std::abs(in[i][c]));
+            }
+
+            // the batched split() must match the single vertex version
+            vec3 h, l;
+            split(in[i], h, l);
+            if (h != high[i] || l != low[i]) ++numMismatched;
+        }
+
+        VSG_CHECK(numNotRounded == 0);
+        VSG_CHECK(numMismatched == 0);
+        VSG_CHECK(numNonZeroLow > in.size() * 3 / 2);
+        VSG_CHECK(maxRelativeError < 1e-14);
+    }
+}
+
+// compare the emulated shader against double precision, for an eye at distance from the scene origin and vertices within radius of the eye
+static void testRelativeToEye(const char* name, double distance, double radius, double maxError)
+{
+    std::mt19937 rng(2);
+    std::uniform_real_distribution<double> u(-1.0, 1.0);
+
+    double maxRelativeToEyeError = 0.0;
+    double maxFloatError = 0.0;
+    for (int i = 0; i < 2000; ++i)
+    {
+        dvec3 eye = normalize(dvec3(u(rng), u(rng), u(rng))) * distance;
+        dvec3 center = eye + dvec3(u(rng), u(rng), u(rng)) * 10.0;
+        dmat4 view = lookAt(eye, center, dvec3(0.0, 0.0, 1.0));
+
+        // world coordinate vertices under a scaled and rotated model matrix, so the eye position is computed in the model's local coordinates
+        dmat4 model = rotate(u(rng), normalize(dvec3(u(rng), u(rng), 1.0))) * scale(2.0, 2.0, 2.0);
+        dmat4 modelview = view * model;
+        dvec3 vertex = inverse_4x3(model) * (center + dvec3(u(rng), u(rng), u(rng)) * radius);
+        dvec3 expected = modelview * vertex;
+
+        vec3 high, low;
+        split(vertex, high, low);
+        dvec3 result(shader(pack(modelview), high, low));
+        maxRelativeToEyeError = std::max(maxRelativeToEyeError, length(result - expected));
+
+        // float vertices and a float modelview matrix, for comparison
+        dvec3 floatResult(mat4(modelview) * vec3(vertex));
+        maxFloatError = std::max(maxFloatError, length(floatResult - expected));
+    }
+
+    std::cout << name << ": relative-to-eye error " << maxRelativeToEyeError << "m, float error " << maxFloatError << "m" << std::endl;
+
+    VSG_CHECK(maxRelativeToEyeError < maxError);
+    VSG_CHECK(maxRelativeToEyeError * 1000.0 < maxFloatError);
+}
+
+int main()
+{
+    testSplit();
+
+    // bounds are two to three times the measured errors, which are dominated by the float rotation and scale of the eye relative position
+    testRelativeToEye("ground", 6.4e6, 100.0, 5e-5);
+    testRelativeToEye("lunar", 3.844e8, 1e3, 5e-4);
+    testRelativeToEye("1 AU", 1.496e11, 1e3, 1.5e-3);
+
+    return vsg_test::result();
+}
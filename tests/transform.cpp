@@ -0,0 +1,79 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2020 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/maths/transform.h>
+
+#include "check.h"
+
+#include <random>
+#include <vector>
+
+using namespace vsg;
+
+template<typename T>
+double difference(const t_mat4<T>& lhs, const t_mat4<T>& rhs)
+{
+    double sum = 0.0;
+    for (int c = 0; c < 4; ++c)
+    {
+        for (int r = 0; r < 4; ++r) sum += std::abs(double(lhs[c][r]) - double(rhs[c][r]));
+    }
+    return sum;
+}
+
+// compare the SIMD transform() and inverse_4x3() against the scalar templates, allowing for the compiler contracting the scalar maths into fused multiply-adds
+template<typename T>
+void testTransform(double epsilon)
+{
+    using mat_type = t_mat4<T>;
+    using vec_type = t_vec3<T>;
+
+    std::mt19937 rng(1);
+    std::uniform_real_distribution<double> u(-2.0, 2.0);
+
+    double maxInverseError = 0.0;
+    double maxTransformError = 0.0;
+    double maxInPlaceError = 0.0;
+    for (int i = 0; i < 1000; ++i)
+    {
+        mat_type m = translate(T(u(rng)), T(u(rng)), T(u(rng))) * rotate(T(u(rng)), normalize(vec_type(T(u(rng)), T(u(rng)), T(1)))) * scale(T(1.5 + u(rng) * 0.5), T(1), T(2));
+        maxInverseError = std::max(maxInverseError, difference(inverse_4x3(m), inverse_4x4(m)));
+
+        // odd counts exercise the remainder handling
+        std::size_t count = 1 + (i % 37);
+        std::vector<vec_type> in(count), out(count);
+        for (auto& v : in) v.set(T(u(rng)), T(u(rng)), T(u(rng)));
+
+        mat_type p = perspective(T(1), T(1.3), T(0.1), T(100)) * m;
+        transform(p, in.data(), out.data(), count);
+        for (std::size_t j = 0; j < count; ++j)
+        {
+            vec_type expected = p * in[j];
+            maxTransformError = std::max(maxTransformError, double(length(expected - out[j])) / (1.0 + double(length(expected))));
+        }
+
+        std::vector<vec_type> inPlace(in);
+        transform(p, inPlace.data(), inPlace.data(), count);
+        for (std::size_t j = 0; j < count; ++j) maxInPlaceError = std::max(maxInPlaceError, double(length(inPlace[j] - out[j])));
+    }
+
+    VSG_CHECK(maxInverseError < epsilon * 100.0);
+    VSG_CHECK(maxTransformError < epsilon);
+    VSG_CHECK(maxInPlaceError == 0.0);
+}
+
+int main()
+{
+    testTransform<float>(1e-5);
+    testTransform<double>(1e-13);
+    return vsg_test::result();
+}